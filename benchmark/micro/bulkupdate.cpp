@@ -84,3 +84,40 @@ string BenchmarkInfo() override {
 	return "Run a bulk delete followed by an aggregate";
 }
 FINISH_BENCHMARK(BulkDelete)
+
+DUCKDB_BENCHMARK(BulkUpdateCommittedScan, "[bulkupdate]")
+int64_t sum = 0;
+int64_t count = 0;
+void Load(DuckDBBenchmarkState *state) override {
+	state->conn.Query("CREATE TABLE integers(i INTEGER);");
+	Appender appender(state->conn, "integers");
+	// insert the elements into the database
+	for (size_t i = 0; i < GROUP_ROW_COUNT; i++) {
+		appender.BeginRow();
+		appender.Append<int32_t>(i % GROUP_COUNT);
+		appender.EndRow();
+
+		sum += i % GROUP_COUNT;
+		count++;
+	}
+	appender.Close();
+	// update every row of the table and commit: subsequent scans read the (committed) updates
+	state->conn.Query("UPDATE integers SET i = i + 1");
+}
+
+void RunBenchmark(DuckDBBenchmarkState *state) override {
+	state->result = state->conn.Query("SELECT SUM(i) FROM integers");
+}
+
+string VerifyResult(QueryResult *result) override {
+	auto &materialized = (MaterializedQueryResult &)*result;
+	Value val = materialized.GetValue(0, 0);
+	if (val != Value::BIGINT(sum + count)) {
+		return string("Value " + val.ToString() + " does not match expected value " + std::to_string(sum + count));
+	}
+	return string();
+}
+string BenchmarkInfo() override {
+	return "Run an aggregate over a table in which every row has been updated";
+}
+FINISH_BENCHMARK(BulkUpdateCommittedScan)
@@ -0,0 +1,155 @@
+#include "http_block_cache.hpp"
+
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/common/to_string.hpp"
+#include "duckdb/common/types/hash.hpp"
+
+namespace duckdb {
+
+static constexpr const char *BLOCK_EXTENSION = ".block";
+static constexpr const char *TEMP_EXTENSION = ".tmp";
+
+HTTPBlockCache::HTTPBlockCache(string directory_p, idx_t max_size_p)
+    : fs(FileSystem::CreateLocal()), directory(std::move(directory_p)), max_size(max_size_p), current_size(0),
+      temp_file_count(0) {
+	if (!fs->DirectoryExists(directory)) {
+		fs->CreateDirectory(directory);
+	}
+	// Pick up the blocks that were written by earlier sessions, and clean up temporary files of interrupted writes
+	vector<string> temp_files;
+	fs->ListFiles(directory, [&](const string &name, bool is_directory) {
+		if (is_directory) {
+			return;
+		}
+		if (StringUtil::EndsWith(name, TEMP_EXTENSION)) {
+			temp_files.push_back(name);
+		} else if (StringUtil::EndsWith(name, BLOCK_EXTENSION)) {
+			auto handle = fs->OpenFile(fs->JoinPath(directory, name),
+			                           FileFlags::FILE_FLAGS_READ | FileFlags::FILE_FLAGS_NULL_IF_NOT_EXISTS);
+			if (handle) {
+				Touch(name, handle->GetFileSize());
+			}
+		}
+	});
+	for (auto &name : temp_files) {
+		fs->RemoveFile(fs->JoinPath(directory, name));
+	}
+}
+
+void HTTPBlockCache::SetMaxSize(idx_t max_size_p) {
+	lock_guard<mutex> guard(lock);
+	max_size = max_size_p;
+	EvictBlocks();
+}
+
+string HTTPBlockCache::GetBlockName(const string &key, idx_t block_idx) const {
+	static constexpr const char *HEX_DIGITS = "0123456789abcdef";
+	auto hash = Hash(key.c_str(), key.size());
+	string result;
+	for (idx_t i = 0; i < sizeof(hash_t) * 2; i++) {
+		result += HEX_DIGITS[(hash >> (60 - i * 4)) & 0xF];
+	}
+	return result + "_" + to_string(block_idx) + BLOCK_EXTENSION;
+}
+
+// A block file consists of the length of the key, the key and the block data. The key is stored so that blocks of
+// different files whose keys have the same hash are never mixed up.
+bool HTTPBlockCache::TryRead(const string &key, idx_t block_idx, data_ptr_t buffer, idx_t block_size) {
+	auto block_name = GetBlockName(key, block_idx);
+	unique_ptr<FileHandle> handle;
+	try {
+		handle = fs->OpenFile(fs->JoinPath(directory, block_name),
+		                      FileFlags::FILE_FLAGS_READ | FileFlags::FILE_FLAGS_NULL_IF_NOT_EXISTS);
+	} catch (std::exception &ex) {
+		return false;
+	}
+	if (!handle) {
+		return false;
+	}
+	auto file_size = handle->GetFileSize();
+	if (file_size != sizeof(uint32_t) + key.size() + block_size) {
+		return false;
+	}
+	uint32_t key_size;
+	handle->Read(&key_size, sizeof(uint32_t), 0);
+	if (key_size != key.size()) {
+		return false;
+	}
+	auto stored_key = make_unsafe_uniq_array<char>(key_size);
+	handle->Read(stored_key.get(), key_size, sizeof(uint32_t));
+	if (memcmp(stored_key.get(), key.c_str(), key_size) != 0) {
+		return false;
+	}
+	handle->Read(buffer, block_size, sizeof(uint32_t) + key_size);
+
+	lock_guard<mutex> guard(lock);
+	Touch(block_name, file_size);
+	return true;
+}
+
+void HTTPBlockCache::Write(const string &key, idx_t block_idx, const_data_ptr_t buffer, idx_t block_size) {
+	auto file_size = sizeof(uint32_t) + key.size() + block_size;
+	auto block_name = GetBlockName(key, block_idx);
+	auto block_path = fs->JoinPath(directory, block_name);
+	string temp_path;
+	{
+		lock_guard<mutex> guard(lock);
+		if (file_size > max_size) {
+			return;
+		}
+		temp_path = block_path + "." + to_string(temp_file_count++) + TEMP_EXTENSION;
+	}
+	// The block is written to a temporary file which is then moved into place, so concurrent readers (and writers of
+	// the same block) only ever see complete blocks
+	try {
+		auto handle = fs->OpenFile(temp_path, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
+		auto key_size = UnsafeNumericCast<uint32_t>(key.size());
+		handle->Write(&key_size, sizeof(uint32_t), 0);
+		handle->Write((void *)key.c_str(), key_size, sizeof(uint32_t));
+		handle->Write((void *)buffer, block_size, sizeof(uint32_t) + key_size);
+		handle->Close();
+		handle.reset();
+		fs->MoveFile(temp_path, block_path);
+	} catch (std::exception &ex) {
+		// e.g. the disk is full: the block is simply not cached
+		try {
+			fs->RemoveFile(temp_path);
+		} catch (...) {
+		}
+		return;
+	}
+
+	lock_guard<mutex> guard(lock);
+	Touch(block_name, file_size);
+}
+
+void HTTPBlockCache::Touch(const string &block_name, idx_t file_size) {
+	auto entry = blocks.find(block_name);
+	if (entry != blocks.end()) {
+		current_size -= entry->second.first;
+		lru.erase(entry->second.second);
+		blocks.erase(entry);
+	}
+	lru.push_front(block_name);
+	blocks[block_name] = make_pair(file_size, lru.begin());
+	current_size += file_size;
+	EvictBlocks();
+}
+
+void HTTPBlockCache::EvictBlocks() {
+	while (current_size > max_size && !lru.empty()) {
+		auto &block_name = lru.back();
+		auto entry = blocks.find(block_name);
+		D_ASSERT(entry != blocks.end());
+		current_size -= entry->second.first;
+		try {
+			fs->RemoveFile(fs->JoinPath(directory, block_name));
+		} catch (std::exception &ex) {
+			// the block might be open elsewhere, or might have been removed already
+		}
+		blocks.erase(entry);
+		lru.pop_back();
+	}
+}
+
+} // namespace duckdb
@@ -39,6 +39,8 @@ HTTPParams HTTPParams::ReadFrom(optional_ptr<FileOpener> opener) {
 	bool keep_alive = DEFAULT_KEEP_ALIVE;
 	bool enable_server_cert_verification = DEFAULT_ENABLE_SERVER_CERT_VERIFICATION;
 	std::string ca_cert_file;
+	std::string block_cache_directory;
+	uint64_t block_cache_max_size = DEFAULT_BLOCK_CACHE_MAX_SIZE;
 
 	Value value;
 	if (FileOpener::TryGetCurrentSetting(opener, "http_timeout", value)) {
@@ -65,10 +67,23 @@ HTTPParams HTTPParams::ReadFrom(optional_ptr<FileOpener> opener) {
 	if (FileOpener::TryGetCurrentSetting(opener, "ca_cert_file", value)) {
 		ca_cert_file = value.ToString();
 	}
+	if (FileOpener::TryGetCurrentSetting(opener, "http_block_cache_directory", value)) {
+		block_cache_directory = value.ToString();
+	}
+	if (FileOpener::TryGetCurrentSetting(opener, "http_block_cache_max_size", value)) {
+		block_cache_max_size = DBConfig::ParseMemoryLimit(value.ToString());
+	}
 
-	return {
-	    timeout,     retries, retry_wait_ms, retry_backoff, force_download, keep_alive, enable_server_cert_verification,
-	    ca_cert_file};
+	return {timeout,
+	        retries,
+	        retry_wait_ms,
+	        retry_backoff,
+	        force_download,
+	        keep_alive,
+	        enable_server_cert_verification,
+	        ca_cert_file,
+	        block_cache_directory,
+	        block_cache_max_size};
 }
 
 void HTTPFileSystem::ParseUrl(string &url, string &path_out, string &proto_host_port_out) {
@@ -311,6 +326,7 @@ unique_ptr<ResponseWrapper> HTTPFileSystem::GetRangeRequest(FileHandle &handle,
 	string path, proto_host_port;
 	ParseUrl(url, path, proto_host_port);
 	auto headers = initialize_http_headers(header_map);
+	auto client = hfs.AcquireClient(proto_host_port);
 
 	// send the Range header to read only subset of file
 	string range_expr = "bytes=" + to_string(file_offset) + "-" + to_string(file_offset + buffer_out_len - 1);
@@ -322,7 +338,7 @@ unique_ptr<ResponseWrapper> HTTPFileSystem::GetRangeRequest(FileHandle &handle,
 		if (hfs.state) {
 			hfs.state->get_count++;
 		}
-		return hfs.http_client->Get(
+		return client->Get(
 		    path.c_str(), *headers,
 		    [&](const duckdb_httplib_openssl::Response &response) {
 			    if (response.status >= 400) {
@@ -366,15 +382,16 @@ unique_ptr<ResponseWrapper> HTTPFileSystem::GetRangeRequest(FileHandle &handle,
 		    });
 	});
 
-	std::function<void(void)> on_retry(
-	    [&]() { hfs.http_client = GetClient(hfs.http_params, proto_host_port.c_str()); });
+	std::function<void(void)> on_retry([&]() { client = GetClient(hfs.http_params, proto_host_port.c_str()); });
 
-	return RunRequestWithRetry(request, url, "GET Range", hfs.http_params, on_retry);
+	auto response = RunRequestWithRetry(request, url, "GET Range", hfs.http_params, on_retry);
+	hfs.ReleaseClient(std::move(client));
+	return response;
 }
 
 HTTPFileHandle::HTTPFileHandle(FileSystem &fs, const string &path, FileOpenFlags flags, const HTTPParams &http_params)
-    : FileHandle(fs, path), http_params(http_params), flags(flags), length(0), buffer_available(0), buffer_idx(0),
-      file_offset(0), buffer_start(0), buffer_end(0) {
+    : FileHandle(fs, path), http_params(http_params), flags(flags), length(0), last_modified(0), buffer_available(0),
+      buffer_idx(0), file_offset(0), buffer_start(0), buffer_end(0) {
 }
 
 unique_ptr<HTTPFileHandle> HTTPFileSystem::CreateHandle(const string &path, FileOpenFlags flags,
@@ -408,12 +425,17 @@ void HTTPFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, id
 	auto &hfh = handle.Cast<HTTPFileHandle>();
 
 	D_ASSERT(hfh.state);
+	// A handle opened for parallel access is read by multiple threads at the same time: its reads leave the read buffer
+	// and the file offset of the handle untouched
+	const bool parallel_access = hfh.flags.RequireParallelAccess();
 	if (hfh.cached_file_handle) {
 		if (!hfh.cached_file_handle->Initialized()) {
 			throw InternalException("Cached file not initialized properly");
 		}
 		memcpy(buffer, hfh.cached_file_handle->GetData() + location, nr_bytes);
-		hfh.file_offset = location + nr_bytes;
+		if (!parallel_access) {
+			hfh.file_offset = location + nr_bytes;
+		}
 		return;
 	}
 
@@ -421,12 +443,14 @@ void HTTPFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, id
 	idx_t buffer_offset = 0;
 
 	// Don't buffer when DirectIO is set or when we are doing parallel reads
-	bool skip_buffer = hfh.flags.DirectIO() || hfh.flags.RequireParallelAccess();
+	bool skip_buffer = hfh.flags.DirectIO() || parallel_access;
 	if (skip_buffer && to_read > 0) {
-		GetRangeRequest(hfh, hfh.path, {}, location, (char *)buffer, to_read);
-		hfh.buffer_available = 0;
-		hfh.buffer_idx = 0;
-		hfh.file_offset = location + nr_bytes;
+		ReadRange(hfh, location, (char *)buffer, to_read);
+		if (!parallel_access) {
+			hfh.buffer_available = 0;
+			hfh.buffer_idx = 0;
+			hfh.file_offset = location + nr_bytes;
+		}
 		return;
 	}
 
@@ -459,14 +483,13 @@ void HTTPFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, id
 
 			// Bypass buffer if we read more than buffer size
 			if (to_read > new_buffer_available) {
-				GetRangeRequest(hfh, hfh.path, {}, location + buffer_offset, (char *)buffer + buffer_offset, to_read);
+				ReadRange(hfh, location + buffer_offset, (char *)buffer + buffer_offset, to_read);
 				hfh.buffer_available = 0;
 				hfh.buffer_idx = 0;
 				hfh.file_offset += to_read;
 				break;
 			} else {
-				GetRangeRequest(hfh, hfh.path, {}, hfh.file_offset, (char *)hfh.read_buffer.get(),
-				                new_buffer_available);
+				ReadRange(hfh, hfh.file_offset, (char *)hfh.read_buffer.get(), new_buffer_available);
 				hfh.buffer_available = new_buffer_available;
 				hfh.buffer_idx = 0;
 				hfh.buffer_start = hfh.file_offset;
@@ -543,6 +566,105 @@ optional_ptr<HTTPMetadataCache> HTTPFileSystem::GetGlobalCache() {
 	return global_metadata_cache.get();
 }
 
+shared_ptr<HTTPBlockCache> HTTPFileSystem::GetBlockCache(optional_ptr<FileOpener> opener,
+                                                         const HTTPParams &http_params) {
+	if (http_params.block_cache_directory.empty()) {
+		return nullptr;
+	}
+	auto db = FileOpener::TryGetDatabase(opener);
+	if (!db) {
+		return nullptr;
+	}
+	// The cache is kept per database (and directory), so the size limit applies to the database as a whole rather
+	// than to each of the HTTP file systems. Handles that are still open keep using a cache in a previous directory.
+	auto &object_cache = db->GetObjectCache();
+	auto block_cache = object_cache.GetOrCreate<HTTPBlockCache>(
+	    "http_block_cache:" + http_params.block_cache_directory, http_params.block_cache_directory,
+	    http_params.block_cache_max_size);
+	if (block_cache) {
+		block_cache->SetMaxSize(http_params.block_cache_max_size);
+	}
+	return block_cache;
+}
+
+void HTTPFileSystem::ReadRange(HTTPFileHandle &hfh, idx_t location, char *buffer, idx_t nr_bytes) {
+	if (!hfh.block_cache || nr_bytes == 0) {
+		GetRangeRequest(hfh, hfh.path, {}, location, buffer, nr_bytes);
+		return;
+	}
+	auto &cache = *hfh.block_cache;
+	const auto block_size = HTTPBlockCache::BLOCK_SIZE;
+	const auto end = location + nr_bytes;
+	const auto first_block = location / block_size;
+	const auto block_count = (end + block_size - 1) / block_size - first_block;
+	auto block_start = [&](idx_t i) {
+		return (first_block + i) * block_size;
+	};
+	auto block_end = [&](idx_t i) {
+		return MinValue<idx_t>(block_start(i) + block_size, hfh.length);
+	};
+	auto in_place = [&](idx_t i) {
+		return block_start(i) >= location && block_end(i) <= end;
+	};
+
+	// Blocks that are read as a whole are read directly into the buffer, the (at most two) blocks that are only partly
+	// read go through a separate buffer
+	unsafe_unique_array<data_t> edge_buffer;
+	vector<data_ptr_t> block_data(block_count);
+	for (idx_t i = 0; i < block_count; i++) {
+		if (in_place(i)) {
+			block_data[i] = data_ptr_cast(buffer) + (block_start(i) - location);
+			continue;
+		}
+		if (!edge_buffer) {
+			edge_buffer = make_unsafe_uniq_array<data_t>(2 * block_size);
+		}
+		block_data[i] = edge_buffer.get() + (i == 0 ? 0 : block_size);
+	}
+
+	vector<bool> cached(block_count);
+	for (idx_t i = 0; i < block_count; i++) {
+		cached[i] = cache.TryRead(hfh.block_cache_key, first_block + i, block_data[i], block_end(i) - block_start(i));
+	}
+	// Consecutive blocks that are not cached are fetched with a single range request
+	for (idx_t i = 0; i < block_count;) {
+		if (cached[i]) {
+			i++;
+			continue;
+		}
+		idx_t run_end = i + 1;
+		while (run_end < block_count && !cached[run_end]) {
+			run_end++;
+		}
+		auto run_start = block_start(i);
+		auto run_length = block_end(run_end - 1) - run_start;
+		if (in_place(i) && in_place(run_end - 1)) {
+			GetRangeRequest(hfh, hfh.path, {}, run_start, char_ptr_cast(block_data[i]), run_length);
+		} else {
+			auto run_buffer = make_unsafe_uniq_array<data_t>(run_length);
+			GetRangeRequest(hfh, hfh.path, {}, run_start, char_ptr_cast(run_buffer.get()), run_length);
+			for (idx_t block = i; block < run_end; block++) {
+				memcpy(block_data[block], run_buffer.get() + (block_start(block) - run_start),
+				       block_end(block) - block_start(block));
+			}
+		}
+		for (idx_t block = i; block < run_end; block++) {
+			cache.Write(hfh.block_cache_key, first_block + block, block_data[block],
+			            block_end(block) - block_start(block));
+		}
+		i = run_end;
+	}
+
+	// Copy the requested parts of the partly read blocks
+	if (!in_place(0)) {
+		memcpy(buffer, block_data[0] + (location - block_start(0)), MinValue<idx_t>(block_end(0), end) - location);
+	}
+	auto last = block_count - 1;
+	if (last > 0 && !in_place(last)) {
+		memcpy(buffer + (block_start(last) - location), block_data[last], end - block_start(last));
+	}
+}
+
 // Get either the local, global, or no cache depending on settings
 static optional_ptr<HTTPMetadataCache> TryGetMetadataCache(optional_ptr<FileOpener> opener, HTTPFileSystem &httpfs) {
 	auto db = FileOpener::TryGetDatabase(opener);
@@ -586,9 +708,11 @@ void HTTPFileHandle::Initialize(optional_ptr<FileOpener> opener) {
 		if (found) {
 			last_modified = value.last_modified;
 			length = value.length;
+			etag = value.etag;
 
 			if (flags.OpenForReading()) {
 				read_buffer = duckdb::unique_ptr<data_t[]>(new data_t[READ_BUFFER_LEN]);
+				InitializeBlockCache(opener);
 			}
 			return;
 		}
@@ -695,9 +819,51 @@ void HTTPFileHandle::Initialize(optional_ptr<FileOpener> opener) {
 		tm.tm_isdst = 0;
 		last_modified = mktime(&tm);
 	}
+	etag = res->headers["ETag"];
 
 	if (should_write_cache) {
-		current_cache->Insert(path, {length, last_modified});
+		current_cache->Insert(path, {length, last_modified, etag});
+	}
+	if (flags.OpenForReading()) {
+		InitializeBlockCache(opener);
+	}
+}
+
+void HTTPFileHandle::InitializeBlockCache(optional_ptr<FileOpener> opener) {
+	// Fully downloaded files are not read in blocks, and files without an ETag or modification time can change
+	// without us noticing
+	if (cached_file_handle || length == 0 || (etag.empty() && last_modified == 0)) {
+		return;
+	}
+	block_cache = HTTPFileSystem::GetBlockCache(opener, http_params);
+	if (!block_cache) {
+		return;
+	}
+	block_cache_key = path + "\n" + to_string(length) + "\n";
+	block_cache_key += etag.empty() ? to_string(last_modified) : etag;
+}
+
+unique_ptr<duckdb_httplib_openssl::Client> HTTPFileHandle::AcquireClient(const string &proto_host_port) {
+	{
+		lock_guard<mutex> lock(client_lock);
+		if (http_client) {
+			return std::move(http_client);
+		}
+		if (!client_cache.empty()) {
+			auto client = std::move(client_cache.back());
+			client_cache.pop_back();
+			return client;
+		}
+	}
+	return HTTPFileSystem::GetClient(http_params, proto_host_port.c_str());
+}
+
+void HTTPFileHandle::ReleaseClient(unique_ptr<duckdb_httplib_openssl::Client> client) {
+	lock_guard<mutex> lock(client_lock);
+	if (!http_client) {
+		http_client = std::move(client);
+	} else {
+		client_cache.push_back(std::move(client));
 	}
 }
 
@@ -36,6 +36,11 @@ static void LoadInternal(DatabaseInstance &instance) {
 	                          LogicalType::BOOLEAN, Value(false));
 	config.AddExtensionOption("ca_cert_file", "Path to a custom certificate file for self-signed certificates.",
 	                          LogicalType::VARCHAR, Value(""));
+	config.AddExtensionOption("http_block_cache_directory",
+	                          "Directory of the local cache of remote file blocks. The cache is disabled if empty.",
+	                          LogicalType::VARCHAR, Value(""));
+	config.AddExtensionOption("http_block_cache_max_size", "Maximum size of the local cache of remote file blocks",
+	                          LogicalType::VARCHAR, Value("1GB"));
 	// Global S3 config
 	config.AddExtensionOption("s3_region", "S3 Region", LogicalType::VARCHAR, Value("us-east-1"));
 	config.AddExtensionOption("s3_access_key_id", "S3 Access Key ID", LogicalType::VARCHAR);
@@ -54,6 +59,9 @@ static void LoadInternal(DatabaseInstance &instance) {
 	                          LogicalType::UBIGINT, Value(10000));
 	config.AddExtensionOption("s3_uploader_thread_limit", "S3 Uploader global thread limit", LogicalType::UBIGINT,
 	                          Value(50));
+	config.AddExtensionOption("s3_uploader_max_memory",
+	                          "S3 Uploader global memory limit for part buffers (default: 25% of the memory limit)",
+	                          LogicalType::VARCHAR, Value(""));
 
 	auto provider = make_uniq<AWSEnvironmentCredentialsProvider>(config);
 	provider->SetAll();
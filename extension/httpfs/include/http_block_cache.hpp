@@ -0,0 +1,62 @@
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/list.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/pair.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/storage/object_cache.hpp"
+
+namespace duckdb {
+
+//! Persistent cache of fixed-size blocks of remote files in a local directory. Blocks are identified by a key that
+//! changes when the remote file changes (i.e. the URL and the ETag), and are evicted in LRU order once the total size
+//! of the cached blocks exceeds the maximum size. The cache lives in the object cache of a database, and is shared by
+//! all of its connections and HTTP file systems.
+class HTTPBlockCache : public ObjectCacheEntry {
+public:
+	static constexpr idx_t BLOCK_SIZE = 1 << 20;
+	static constexpr idx_t DEFAULT_MAX_SIZE = idx_t(1) << 30;
+
+	HTTPBlockCache(string directory, idx_t max_size);
+
+	static string ObjectType() {
+		return "http_block_cache";
+	}
+	string GetObjectType() override {
+		return ObjectType();
+	}
+
+	const string &GetDirectory() const {
+		return directory;
+	}
+	void SetMaxSize(idx_t max_size);
+
+	//! Reads block "block_idx" of the file with the given key into "buffer", returns false if it is not cached
+	bool TryRead(const string &key, idx_t block_idx, data_ptr_t buffer, idx_t block_size);
+	//! Stores block "block_idx" of the file with the given key. Failures to write the block are ignored.
+	void Write(const string &key, idx_t block_idx, const_data_ptr_t buffer, idx_t block_size);
+
+private:
+	string GetBlockName(const string &key, idx_t block_idx) const;
+	//! Marks a block as most recently used (and adds it if it is not known yet), then evicts blocks if needed
+	void Touch(const string &block_name, idx_t file_size);
+	void EvictBlocks();
+
+private:
+	unique_ptr<FileSystem> fs;
+	const string directory;
+
+	mutex lock;
+	idx_t max_size;
+	idx_t current_size;
+	//! The block names, most recently used first
+	list<string> lru;
+	//! Block name -> (file size, position in the LRU list)
+	unordered_map<string, pair<idx_t, list<string>::iterator>> blocks;
+	//! Used to give concurrently written blocks distinct temporary files
+	idx_t temp_file_count;
+};
+
+} // namespace duckdb
@@ -3,9 +3,11 @@
 #include "duckdb/common/case_insensitive_map.hpp"
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/http_state.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/common/pair.hpp"
 #include "duckdb/common/unordered_map.hpp"
 #include "duckdb/main/client_data.hpp"
+#include "http_block_cache.hpp"
 #include "http_metadata_cache.hpp"
 
 namespace duckdb_httplib_openssl {
@@ -37,6 +39,7 @@ struct HTTPParams {
 	static constexpr bool DEFAULT_FORCE_DOWNLOAD = false;
 	static constexpr bool DEFAULT_KEEP_ALIVE = true;
 	static constexpr bool DEFAULT_ENABLE_SERVER_CERT_VERIFICATION = false;
+	static constexpr uint64_t DEFAULT_BLOCK_CACHE_MAX_SIZE = HTTPBlockCache::DEFAULT_MAX_SIZE;
 
 	uint64_t timeout;
 	uint64_t retries;
@@ -46,6 +49,9 @@ struct HTTPParams {
 	bool keep_alive;
 	bool enable_server_cert_verification;
 	std::string ca_cert_file;
+	//! The directory of the local block cache, the cache is disabled if this is empty
+	std::string block_cache_directory;
+	uint64_t block_cache_max_size;
 
 	static HTTPParams ReadFrom(optional_ptr<FileOpener> opener);
 };
@@ -60,12 +66,19 @@ public:
 	// We keep an http client stored for connection reuse with keep-alive headers
 	duckdb::unique_ptr<duckdb_httplib_openssl::Client> http_client;
 
+	// Range requests can be made by multiple threads at the same time, e.g. when prefetching the column chunks of a
+	// parquet file. Each request takes a client of its own: the http client if it is not in use, otherwise a cached or
+	// a new client.
+	duckdb::unique_ptr<duckdb_httplib_openssl::Client> AcquireClient(const string &proto_host_port);
+	void ReleaseClient(duckdb::unique_ptr<duckdb_httplib_openssl::Client> client);
+
 	const HTTPParams http_params;
 
 	// File handle info
 	FileOpenFlags flags;
 	idx_t length;
 	time_t last_modified;
+	string etag;
 
 	// When using full file download, the full file will be written to a cached file handle
 	unique_ptr<CachedFileHandle> cached_file_handle;
@@ -83,12 +96,24 @@ public:
 
 	shared_ptr<HTTPState> state;
 
+	// When the local block cache is enabled, ranges of the file are read through the block cache
+	shared_ptr<HTTPBlockCache> block_cache;
+	//! Identifies this version of the file in the block cache
+	string block_cache_key;
+
 public:
 	void Close() override {
 	}
 
 protected:
 	virtual void InitializeClient();
+
+private:
+	void InitializeBlockCache(optional_ptr<FileOpener> opener);
+
+private:
+	mutex client_lock;
+	vector<duckdb::unique_ptr<duckdb_httplib_openssl::Client>> client_cache;
 };
 
 class HTTPFileSystem : public FileSystem {
@@ -137,6 +162,10 @@ public:
 	bool OnDiskFile(FileHandle &handle) override {
 		return false;
 	}
+	//! Reads at a location of a handle opened with FILE_FLAGS_PARALLEL_ACCESS bypass the read buffer of the handle
+	bool SupportsPositionalReads(FileHandle &handle) override {
+		return true;
+	}
 	bool IsPipe(const string &filename, optional_ptr<FileOpener> opener) override {
 		return false;
 	}
@@ -149,10 +178,13 @@ public:
 	static void Verify();
 
 	optional_ptr<HTTPMetadataCache> GetGlobalCache();
+	static shared_ptr<HTTPBlockCache> GetBlockCache(optional_ptr<FileOpener> opener, const HTTPParams &http_params);
 
 protected:
 	virtual duckdb::unique_ptr<HTTPFileHandle> CreateHandle(const string &path, FileOpenFlags flags,
 	                                                        optional_ptr<FileOpener> opener);
+	// Reads a range of the file, either through the block cache or with a single range request
+	void ReadRange(HTTPFileHandle &hfh, idx_t location, char *buffer, idx_t nr_bytes);
 
 private:
 	// Global cache
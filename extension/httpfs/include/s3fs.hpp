@@ -74,6 +74,8 @@ struct S3ConfigParams {
 	uint64_t max_file_size;
 	uint64_t max_parts_per_file;
 	uint64_t max_upload_threads;
+	//! The memory that the write buffers of all files can use, 0 means a quarter of the memory limit
+	uint64_t max_upload_memory;
 
 	static S3ConfigParams ReadFrom(optional_ptr<FileOpener> opener);
 };
@@ -92,12 +94,13 @@ class S3FileSystem;
 // Holds the buffered data for 1 part of an S3 Multipart upload
 class S3WriteBuffer {
 public:
-	explicit S3WriteBuffer(idx_t buffer_start, size_t buffer_size, BufferHandle buffer_p)
-	    : idx(0), buffer_start(buffer_start), buffer(std::move(buffer_p)) {
+	explicit S3WriteBuffer(S3FileSystem &fs, idx_t buffer_start, size_t buffer_size, BufferHandle buffer_p)
+	    : idx(0), buffer_start(buffer_start), buffer(std::move(buffer_p)), fs(fs) {
 		buffer_end = buffer_start + buffer_size;
 		part_no = buffer_start / buffer_size;
 		uploading = false;
 	}
+	~S3WriteBuffer();
 
 	void *Ptr() {
 		return buffer.Ptr();
@@ -111,6 +114,9 @@ public:
 	idx_t buffer_end;
 	BufferHandle buffer;
 	atomic<bool> uploading;
+
+private:
+	S3FileSystem &fs;
 };
 
 class S3FileHandle : public HTTPFileHandle {
@@ -149,7 +155,6 @@ protected:
 
 	//! Synchronization for upload threads
 	mutex uploads_in_progress_lock;
-	std::condition_variable uploads_in_progress_cv;
 	std::condition_variable final_flush_cv;
 	uint16_t uploads_in_progress;
 
@@ -225,8 +230,10 @@ public:
 	bool ListFiles(const string &directory, const std::function<void(const string &, bool)> &callback,
 	               FileOpener *opener = nullptr) override;
 
-	//! Wrapper around BufferManager::Allocate to limit the number of buffers
-	BufferHandle Allocate(idx_t part_size, uint16_t max_threads);
+	//! Wrapper around BufferManager::Allocate to limit the memory used by the write buffers of all files
+	BufferHandle Allocate(idx_t part_size, idx_t max_upload_memory);
+	//! Called when a write buffer allocated with Allocate is destroyed
+	void ReleaseWriteBuffer(idx_t part_size);
 
 	//! S3 is object storage so directories effectively always exist
 	bool DirectoryExists(const string &directory, optional_ptr<FileOpener> opener = nullptr) override {
@@ -241,6 +248,13 @@ protected:
 	void FlushBuffer(S3FileHandle &handle, shared_ptr<S3WriteBuffer> write_buffer);
 	string GetPayloadHash(char *buffer, idx_t buffer_len);
 
+	//! The uploads of all files that are being written share a limited number of upload threads and a memory budget
+	//! for their write buffers, so that writing many files at the same time does not run out of memory
+	mutex upload_lock;
+	std::condition_variable upload_cv;
+	idx_t upload_memory = 0;
+	idx_t uploads_in_flight = 0;
+
 	// helper for ReadQueryParams
 	void GetQueryParam(const string &key, string &param, CPPHTTPLIB_NAMESPACE::Params &query_params);
 };
@@ -328,6 +328,7 @@ S3ConfigParams S3ConfigParams::ReadFrom(optional_ptr<FileOpener> opener) {
 	uint64_t uploader_max_filesize;
 	uint64_t max_parts_per_file;
 	uint64_t max_upload_threads;
+	uint64_t max_upload_memory = 0;
 	Value value;
 
 	if (FileOpener::TryGetCurrentSetting(opener, "s3_uploader_max_filesize", value)) {
@@ -348,7 +349,12 @@ S3ConfigParams S3ConfigParams::ReadFrom(optional_ptr<FileOpener> opener) {
 		max_upload_threads = S3ConfigParams::DEFAULT_MAX_UPLOAD_THREADS;
 	}
 
-	return {uploader_max_filesize, max_parts_per_file, max_upload_threads};
+	if (FileOpener::TryGetCurrentSetting(opener, "s3_uploader_max_memory", value) &&
+	    !value.GetValue<string>().empty()) {
+		max_upload_memory = DBConfig::ParseMemoryLimit(value.GetValue<string>());
+	}
+
+	return {uploader_max_filesize, max_parts_per_file, max_upload_threads, max_upload_memory};
 }
 
 void S3FileHandle::Close() {
@@ -394,13 +400,16 @@ string S3FileSystem::InitializeMultipartUpload(S3FileHandle &file_handle) {
 }
 
 void S3FileSystem::NotifyUploadsInProgress(S3FileHandle &file_handle) {
+	auto &s3fs = (S3FileSystem &)file_handle.file_system;
+	{
+		unique_lock<mutex> lck(s3fs.upload_lock);
+		s3fs.uploads_in_flight--;
+	}
+	s3fs.upload_cv.notify_all();
 	{
 		unique_lock<mutex> lck(file_handle.uploads_in_progress_lock);
 		file_handle.uploads_in_progress--;
 	}
-	// Note that there are 2 cv's because otherwise we might deadlock when the final flushing thread is notified while
-	// another thread is still waiting for an upload thread
-	file_handle.uploads_in_progress_cv.notify_one();
 	file_handle.final_flush_cv.notify_one();
 }
 
@@ -434,6 +443,7 @@ void S3FileSystem::UploadBuffer(S3FileHandle &file_handle, shared_ptr<S3WriteBuf
 			file_handle.upload_exception = std::current_exception();
 		}
 
+		write_buffer.reset();
 		NotifyUploadsInProgress(file_handle);
 
 		return;
@@ -474,15 +484,15 @@ void S3FileSystem::FlushBuffer(S3FileHandle &file_handle, shared_ptr<S3WriteBuff
 		file_handle.write_buffers.erase(write_buffer->part_no);
 	}
 
+	{
+		// check if there are upload threads available - if not, wait for one to become available. The limit is shared
+		// by all files that are being written.
+		unique_lock<mutex> lck(upload_lock);
+		upload_cv.wait(lck, [&] { return uploads_in_flight < file_handle.config_params.max_upload_threads; });
+		uploads_in_flight++;
+	}
 	{
 		unique_lock<mutex> lck(file_handle.uploads_in_progress_lock);
-		// check if there are upload threads available
-		if (file_handle.uploads_in_progress >= file_handle.config_params.max_upload_threads) {
-			// there are not - wait for one to become available
-			file_handle.uploads_in_progress_cv.wait(lck, [&file_handle] {
-				return file_handle.uploads_in_progress < file_handle.config_params.max_upload_threads;
-			});
-		}
 		file_handle.uploads_in_progress++;
 	}
 
@@ -508,6 +518,8 @@ void S3FileSystem::FlushAllBuffers(S3FileHandle &file_handle) {
 			FlushBuffer(file_handle, write_buffer);
 		}
 	}
+	// Don't keep the buffers alive while waiting, their memory is released as soon as they are uploaded
+	to_flush.clear();
 	unique_lock<mutex> lck(file_handle.uploads_in_progress_lock);
 	file_handle.final_flush_cv.wait(lck, [&file_handle] { return file_handle.uploads_in_progress == 0; });
 
@@ -548,9 +560,38 @@ void S3FileSystem::FinalizeMultipartUpload(S3FileHandle &file_handle) {
 	}
 }
 
-// Wrapper around the BufferManager::Allocate to that allows limiting the number of buffers that will be handed out
-BufferHandle S3FileSystem::Allocate(idx_t part_size, uint16_t max_threads) {
-	return buffer_manager.Allocate(MemoryTag::EXTENSION, part_size);
+// Wrapper around the BufferManager::Allocate to that allows limiting the memory of the buffers that are handed out
+BufferHandle S3FileSystem::Allocate(idx_t part_size, idx_t max_upload_memory) {
+	if (max_upload_memory == 0) {
+		max_upload_memory = buffer_manager.GetMaxMemory() / 4;
+	}
+	{
+		// Wait until enough buffers have been uploaded. If there are no uploads in flight, no memory is going to be
+		// released: e.g. all buffers are partially written by the thread that is waiting here. In that case we go
+		// over the budget rather than wait forever.
+		unique_lock<mutex> lck(upload_lock);
+		upload_cv.wait(lck, [&] { return upload_memory + part_size <= max_upload_memory || uploads_in_flight == 0; });
+		upload_memory += part_size;
+	}
+	try {
+		return buffer_manager.Allocate(MemoryTag::EXTENSION, part_size);
+	} catch (...) {
+		ReleaseWriteBuffer(part_size);
+		throw;
+	}
+}
+
+void S3FileSystem::ReleaseWriteBuffer(idx_t part_size) {
+	{
+		unique_lock<mutex> lck(upload_lock);
+		upload_memory -= part_size;
+	}
+	upload_cv.notify_all();
+}
+
+S3WriteBuffer::~S3WriteBuffer() {
+	buffer.Destroy();
+	fs.ReleaseWriteBuffer(buffer_end - buffer_start);
 }
 
 shared_ptr<S3WriteBuffer> S3FileHandle::GetBuffer(uint16_t write_buffer_idx) {
@@ -566,9 +607,9 @@ shared_ptr<S3WriteBuffer> S3FileHandle::GetBuffer(uint16_t write_buffer_idx) {
 		}
 	}
 
-	auto buffer_handle = s3fs.Allocate(part_size, config_params.max_upload_threads);
+	auto buffer_handle = s3fs.Allocate(part_size, config_params.max_upload_memory);
 	auto new_write_buffer =
-	    make_shared_ptr<S3WriteBuffer>(write_buffer_idx * part_size, part_size, std::move(buffer_handle));
+	    make_shared_ptr<S3WriteBuffer>(s3fs, write_buffer_idx * part_size, part_size, std::move(buffer_handle));
 	{
 		unique_lock<mutex> lck(write_buffers_lock);
 		auto lookup_result = write_buffers.find(write_buffer_idx);
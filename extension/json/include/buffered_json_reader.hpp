@@ -49,6 +49,9 @@ public:
 	AllocatedData buffer;
 	//! The size of the data in the buffer (can be less than buffer.GetSize())
 	const idx_t buffer_size;
+	//! Offset of the value at the end of the buffer that continues in the next buffer (not for newline-delimited)
+	//! Set by the reader of this buffer before parsing, so that the reader of the next buffer can start right away
+	atomic<idx_t> remainder_offset;
 };
 
 struct JSONFileHandle {
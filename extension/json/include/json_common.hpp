@@ -225,6 +225,26 @@ public:
 	//! Throw an error with the printed yyjson_val
 	static void ThrowValFormatError(string error_string, yyjson_val *val);
 
+public:
+	//===--------------------------------------------------------------------===//
+	// Binary JSON
+	//===--------------------------------------------------------------------===//
+	//! Name of the binary JSON type
+	static constexpr const char *BINARY_TYPE_NAME = "JSONB";
+	//! The binary JSON type stores the values of a parsed (immutable) yyjson document, so it can be read without
+	//! parsing. Its physical type is BLOB
+	static LogicalType BinaryJSONType();
+	static bool IsBinaryJSONType(const LogicalType &type);
+
+	//! Write a value (and all of its children) in the binary JSON layout
+	static string_t WriteBinary(yyjson_val *val, Vector &result);
+	//! Read a value in the binary JSON layout, the returned value references the input
+	static yyjson_val *ReadBinary(const string_t &input, yyjson_alc *alc);
+	//! Read the root of either a binary or a text JSON document
+	static inline yyjson_val *ReadRoot(const string_t &input, const bool binary, yyjson_alc *alc) {
+		return binary ? ReadBinary(input, alc) : ReadDocument(input, READ_FLAG, alc)->root;
+	}
+
 public:
 	//===--------------------------------------------------------------------===//
 	// JSON pointer / path
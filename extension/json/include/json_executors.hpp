@@ -39,15 +39,15 @@ public:
 		auto alc = lstate.json_allocator.GetYYAlc();
 
 		auto &inputs = args.data[0];
+		const bool binary = JSONCommon::IsBinaryJSONType(inputs.GetType());
 		if (info.constant) { // Constant path
 			const char *ptr = info.ptr;
 			const idx_t &len = info.len;
 			if (info.path_type == JSONCommon::JSONPathType::REGULAR) {
 				UnaryExecutor::ExecuteWithNulls<string_t, T>(
 				    inputs, result, args.size(), [&](string_t input, ValidityMask &mask, idx_t idx) {
-					    auto doc =
-					        JSONCommon::ReadDocument(input, JSONCommon::READ_FLAG, lstate.json_allocator.GetYYAlc());
-					    auto val = JSONCommon::GetUnsafe(doc->root, ptr, len);
+					    auto root = JSONCommon::ReadRoot(input, binary, lstate.json_allocator.GetYYAlc());
+					    auto val = JSONCommon::GetUnsafe(root, ptr, len);
 					    if (!val || unsafe_yyjson_is_null(val)) {
 						    mask.SetInvalid(idx);
 						    return T {};
@@ -61,8 +61,8 @@ public:
 				UnaryExecutor::Execute<string_t, list_entry_t>(inputs, result, args.size(), [&](string_t input) {
 					vals.clear();
 
-					auto doc = JSONCommon::ReadDocument(input, JSONCommon::READ_FLAG, lstate.json_allocator.GetYYAlc());
-					JSONCommon::GetWildcardPath(doc->root, ptr, len, vals);
+					auto root = JSONCommon::ReadRoot(input, binary, lstate.json_allocator.GetYYAlc());
+					JSONCommon::GetWildcardPath(root, ptr, len, vals);
 
 					auto current_size = ListVector::GetListSize(result);
 					auto new_size = current_size + vals.size();
@@ -93,8 +93,8 @@ public:
 			auto &paths = args.data[1];
 			BinaryExecutor::ExecuteWithNulls<string_t, string_t, T>(
 			    inputs, paths, result, args.size(), [&](string_t input, string_t path, ValidityMask &mask, idx_t idx) {
-				    auto doc = JSONCommon::ReadDocument(input, JSONCommon::READ_FLAG, lstate.json_allocator.GetYYAlc());
-				    auto val = JSONCommon::Get(doc->root, path);
+				    auto root = JSONCommon::ReadRoot(input, binary, lstate.json_allocator.GetYYAlc());
+				    auto val = JSONCommon::Get(root, path);
 				    if (!val || unsafe_yyjson_is_null(val)) {
 					    mask.SetInvalid(idx);
 					    return T {};
@@ -124,6 +124,7 @@ public:
 
 		UnifiedVectorFormat input_data;
 		auto &input_vector = args.data[0];
+		const bool binary = JSONCommon::IsBinaryJSONType(input_vector.GetType());
 		input_vector.ToUnifiedFormat(count, input_data);
 		auto inputs = UnifiedVectorFormat::GetData<string_t>(input_data);
 
@@ -144,10 +145,10 @@ public:
 				continue;
 			}
 
-			auto doc = JSONCommon::ReadDocument(inputs[idx], JSONCommon::READ_FLAG, lstate.json_allocator.GetYYAlc());
+			auto root = JSONCommon::ReadRoot(inputs[idx], binary, lstate.json_allocator.GetYYAlc());
 			for (idx_t path_i = 0; path_i < num_paths; path_i++) {
 				auto child_idx = offset + path_i;
-				val = JSONCommon::GetUnsafe(doc->root, info.ptrs[path_i], info.lens[path_i]);
+				val = JSONCommon::GetUnsafe(root, info.ptrs[path_i], info.lens[path_i]);
 				if (!val || unsafe_yyjson_is_null(val)) {
 					child_validity.SetInvalid(child_idx);
 				} else {
@@ -20,6 +20,8 @@ struct CastParameters;
 struct CastLocalStateParameters;
 struct JSONScanInfo;
 class BuiltinFunctions;
+struct OptimizerExtensionInput;
+class LogicalOperator;
 
 // Scalar function stuff
 struct JSONReadFunctionData : public FunctionData {
@@ -77,6 +79,10 @@ public:
 	static void RegisterSimpleCastFunctions(CastFunctionSet &casts);
 	static void RegisterJSONCreateCastFunctions(CastFunctionSet &casts);
 	static void RegisterJSONTransformCastFunctions(CastFunctionSet &casts);
+	//! Rewrites json_extract/json_extract_string calls with constant paths on STRUCTs into struct_extract calls, and
+	//! groups the calls on the same input within a projection or aggregate into a single call that extracts all paths,
+	//! so that each document is only parsed once
+	static void OptimizeExtractFunctions(OptimizerExtensionInput &input, unique_ptr<LogicalOperator> &plan);
 
 private:
 	// Scalar functions
@@ -238,7 +238,10 @@ private:
 	void SkipOverArrayStart();
 
 	void ReadAndAutoDetect(JSONScanGlobalState &gstate, AllocatedData &buffer, optional_idx &buffer_index);
+	JSONBufferHandle &WaitForPreviousBuffer();
 	bool ReconstructFirstObject(JSONScanGlobalState &gstate);
+	bool ReconstructFirstValue(JSONScanGlobalState &gstate);
+	void SplitOffRemainder();
 	void ParseNextChunk(JSONScanGlobalState &gstate);
 
 	void ParseJSON(char *const json_start, const idx_t json_size, const idx_t remaining);
@@ -249,6 +252,8 @@ private:
 	bool IsParallel(JSONScanGlobalState &gstate) const;
 
 private:
+	//! Client context
+	ClientContext &context;
 	//! Bind data
 	const JSONScanData &bind_data;
 	//! Thread-local allocator
@@ -270,7 +275,6 @@ private:
 	char *buffer_ptr;
 	idx_t buffer_size;
 	idx_t buffer_offset;
-	idx_t prev_buffer_remainder;
 	idx_t lines_or_objects_in_buffer;
 
 	//! Buffer to reconstruct split values
@@ -308,4 +308,148 @@ void JSONCommon::GetWildcardPath(yyjson_val *val, const char *ptr, const idx_t &
 	GetWildcardPathInternal(val, ptr, end, vals);
 }
 
+//===--------------------------------------------------------------------===//
+// Binary JSON
+//===--------------------------------------------------------------------===//
+// The values of an immutable yyjson document are stored contiguously in pre-order, and containers store the (relative)
+// byte offset of their next sibling, so a value and its children can be copied as-is. Only strings are stored as
+// pointers, which we store as offsets into a string section instead. The layout is:
+// [uint32_t version][uint32_t value count][value count * yyjson_val][strings (each followed by a '\0')]
+static constexpr uint32_t BINARY_JSON_VERSION = 1;
+static constexpr idx_t BINARY_JSON_HEADER_SIZE = 2 * sizeof(uint32_t);
+
+LogicalType JSONCommon::BinaryJSONType() {
+	auto binary_json_type = LogicalType(LogicalTypeId::BLOB);
+	binary_json_type.SetAlias(BINARY_TYPE_NAME);
+	return binary_json_type;
+}
+
+bool JSONCommon::IsBinaryJSONType(const LogicalType &type) {
+	return type.id() == LogicalTypeId::BLOB && type.HasAlias() && type.GetAlias() == BINARY_TYPE_NAME;
+}
+
+static inline bool IsStringVal(const yyjson_val &val) {
+	const auto type = unsafe_yyjson_get_type(const_cast<yyjson_val *>(&val));
+	return type == YYJSON_TYPE_STR || type == YYJSON_TYPE_RAW;
+}
+
+string_t JSONCommon::WriteBinary(yyjson_val *val, Vector &result) {
+	const auto count = NumericCast<idx_t>(unsafe_yyjson_get_next(val) - val);
+	if (count > NumericLimits<uint32_t>::Maximum()) {
+		throw InvalidInputException("JSON value is too large to be stored as %s", BINARY_TYPE_NAME);
+	}
+	idx_t string_size = 0;
+	for (idx_t i = 0; i < count; i++) {
+		if (IsStringVal(val[i])) {
+			string_size += unsafe_yyjson_get_len(&val[i]) + 1;
+		}
+	}
+	const auto values_size = count * sizeof(yyjson_val);
+	auto target = StringVector::EmptyString(result, BINARY_JSON_HEADER_SIZE + values_size + string_size);
+	auto data = data_ptr_cast(target.GetDataWriteable());
+	Store<uint32_t>(BINARY_JSON_VERSION, data);
+	Store<uint32_t>(UnsafeNumericCast<uint32_t>(count), data + sizeof(uint32_t));
+	auto values = data + BINARY_JSON_HEADER_SIZE;
+	auto strings = values + values_size;
+	idx_t string_offset = 0;
+	for (idx_t i = 0; i < count; i++) {
+		yyjson_val copy = val[i];
+		if (IsStringVal(copy)) {
+			const auto len = unsafe_yyjson_get_len(&copy);
+			memcpy(strings + string_offset, copy.uni.str, len);
+			strings[string_offset + len] = '\0';
+			copy.uni.ofs = string_offset;
+			string_offset += len + 1;
+		}
+		memcpy(values + i * sizeof(yyjson_val), &copy, sizeof(yyjson_val));
+	}
+	target.Finalize();
+	return target;
+}
+
+static void ThrowInvalidBinary() {
+	throw InvalidInputException("Invalid %s value", JSONCommon::BINARY_TYPE_NAME);
+}
+
+yyjson_val *JSONCommon::ReadBinary(const string_t &input, yyjson_alc *alc) {
+	const auto size = input.GetSize();
+	const auto data = const_data_ptr_cast(input.GetData());
+	if (size < BINARY_JSON_HEADER_SIZE || Load<uint32_t>(data) != BINARY_JSON_VERSION) {
+		ThrowInvalidBinary();
+	}
+	const idx_t count = Load<uint32_t>(data + sizeof(uint32_t));
+	const auto values_size = count * sizeof(yyjson_val);
+	if (count == 0 || size < BINARY_JSON_HEADER_SIZE + values_size) {
+		ThrowInvalidBinary();
+	}
+	const auto strings = const_char_ptr_cast(data + BINARY_JSON_HEADER_SIZE + values_size);
+	const auto string_size = size - BINARY_JSON_HEADER_SIZE - values_size;
+
+	// Copy the values to aligned memory, and turn the string offsets back into pointers
+	// While doing so, we verify the structure, so that navigating the values can never go out of bounds
+	auto vals = AllocateArray<yyjson_val>(alc, count);
+	memcpy(vals, data + BINARY_JSON_HEADER_SIZE, values_size);
+	struct ContainerEntry {
+		//! Index of the value after the container
+		idx_t end;
+		//! Number of remaining children (for objects, keys and values are both counted)
+		idx_t remaining;
+		bool is_object;
+	};
+	vector<ContainerEntry> containers;
+	containers.push_back({count, 1, false});
+	for (idx_t i = 0; i < count; i++) {
+		auto &parent = containers.back();
+		if (parent.remaining == 0) {
+			ThrowInvalidBinary();
+		}
+		const bool is_key = parent.is_object && parent.remaining % 2 == 0;
+		parent.remaining--;
+		auto &val = vals[i];
+		const auto len = unsafe_yyjson_get_len(&val);
+		switch (unsafe_yyjson_get_type(&val)) {
+		case YYJSON_TYPE_NULL:
+		case YYJSON_TYPE_BOOL:
+		case YYJSON_TYPE_NUM:
+			if (is_key) {
+				ThrowInvalidBinary();
+			}
+			break;
+		case YYJSON_TYPE_STR:
+		case YYJSON_TYPE_RAW: {
+			const auto offset = val.uni.ofs;
+			if (offset >= string_size || len >= string_size - offset || strings[offset + len] != '\0') {
+				ThrowInvalidBinary();
+			}
+			val.uni.str = strings + offset;
+			break;
+		}
+		case YYJSON_TYPE_ARR:
+		case YYJSON_TYPE_OBJ: {
+			const auto ofs = val.uni.ofs;
+			const bool is_object = unsafe_yyjson_is_obj(&val);
+			if (is_key || ofs == 0 || ofs % sizeof(yyjson_val) != 0 ||
+			    ofs / sizeof(yyjson_val) > parent.end - i) {
+				ThrowInvalidBinary();
+			}
+			containers.push_back({i + ofs / sizeof(yyjson_val), is_object ? 2 * len : len, is_object});
+			break;
+		}
+		default:
+			ThrowInvalidBinary();
+		}
+		// Close the containers that have all of their children
+		while (containers.back().remaining == 0 && containers.size() > 1) {
+			if (containers.back().end != i + 1) {
+				ThrowInvalidBinary();
+			}
+			containers.pop_back();
+		}
+	}
+	if (containers.size() != 1 || containers.back().remaining != 0) {
+		ThrowInvalidBinary();
+	}
+	return vals;
+}
+
 } // namespace duckdb
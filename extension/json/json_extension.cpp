@@ -6,6 +6,7 @@
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/function/copy_function.hpp"
 #include "duckdb/main/extension_util.hpp"
+#include "duckdb/optimizer/optimizer_extension.hpp"
 #include "duckdb/parser/expression/constant_expression.hpp"
 #include "duckdb/parser/expression/function_expression.hpp"
 #include "duckdb/parser/parsed_data/create_pragma_function_info.hpp"
@@ -28,6 +29,7 @@ void JsonExtension::Load(DuckDB &db) {
 	// JSON type
 	auto json_type = LogicalType::JSON();
 	ExtensionUtil::RegisterType(db_instance, LogicalType::JSON_TYPE_NAME, std::move(json_type));
+	ExtensionUtil::RegisterType(db_instance, JSONCommon::BINARY_TYPE_NAME, JSONCommon::BinaryJSONType());
 
 	// JSON casts
 	JSONFunctions::RegisterSimpleCastFunctions(DBConfig::GetConfig(db_instance).GetCastFunctions());
@@ -53,6 +55,12 @@ void JsonExtension::Load(DuckDB &db) {
 	auto &config = DBConfig::GetConfig(*db.instance);
 	config.replacement_scans.emplace_back(JSONFunctions::ReadJSONReplacement);
 
+	// JSON optimizer rule that avoids parsing documents for extracts on STRUCTs, and parses documents once for
+	// multiple extracts
+	OptimizerExtension json_optimizer;
+	json_optimizer.pre_optimize_function = JSONFunctions::OptimizeExtractFunctions;
+	config.optimizer_extensions.push_back(std::move(json_optimizer));
+
 	// JSON copy function
 	auto copy_fun = JSONFunctions::GetJSONCopyFunction();
 	ExtensionUtil::RegisterFunction(db_instance, std::move(copy_fun));
@@ -240,6 +240,45 @@ static bool CastVarcharToJSON(Vector &source, Vector &result, idx_t count, CastP
 	return success;
 }
 
+static bool CastToBinaryJSON(Vector &source, Vector &result, idx_t count, CastParameters &parameters) {
+	auto &lstate = parameters.local_state->Cast<JSONFunctionLocalState>();
+	lstate.json_allocator.Reset();
+	auto alc = lstate.json_allocator.GetYYAlc();
+
+	bool success = true;
+	UnaryExecutor::ExecuteWithNulls<string_t, string_t>(
+	    source, result, count, [&](string_t input, ValidityMask &mask, idx_t idx) {
+		    auto data = input.GetDataWriteable();
+		    const auto length = input.GetSize();
+
+		    yyjson_read_err error;
+		    auto doc = JSONCommon::ReadDocumentUnsafe(data, length, JSONCommon::READ_FLAG, alc, &error);
+
+		    if (!doc) {
+			    mask.SetInvalid(idx);
+			    if (success) {
+				    HandleCastError::AssignError(JSONCommon::FormatParseError(data, length, error), parameters);
+				    success = false;
+			    }
+			    return string_t {};
+		    }
+		    return JSONCommon::WriteBinary(doc->root, result);
+	    });
+	return success;
+}
+
+static bool CastBinaryJSONToJSON(Vector &source, Vector &result, idx_t count, CastParameters &parameters) {
+	auto &lstate = parameters.local_state->Cast<JSONFunctionLocalState>();
+	lstate.json_allocator.Reset();
+	auto alc = lstate.json_allocator.GetYYAlc();
+
+	UnaryExecutor::Execute<string_t, string_t>(source, result, count, [&](string_t input) {
+		auto val = JSONCommon::ReadBinary(input, alc);
+		return StringVector::AddString(result, JSONCommon::WriteVal<yyjson_val>(val, alc));
+	});
+	return true;
+}
+
 void JSONFunctions::RegisterSimpleCastFunctions(CastFunctionSet &casts) {
 	// JSON to VARCHAR is basically free
 	casts.RegisterCastFunction(LogicalType::JSON(), LogicalType::VARCHAR, DefaultCasts::ReinterpretCast, 1);
@@ -254,6 +293,19 @@ void JSONFunctions::RegisterSimpleCastFunctions(CastFunctionSet &casts) {
 	auto null_to_json_cost = casts.ImplicitCastCost(LogicalType::SQLNULL, LogicalTypeId::VARCHAR) + 1;
 	casts.RegisterCastFunction(LogicalType::SQLNULL, LogicalType::JSON(), DefaultCasts::TryVectorNullCast,
 	                           null_to_json_cost);
+
+	// The binary JSON type is parsed once when it is created, and can be read without parsing.
+	// Reading JSONB as JSON is cheap compared to parsing, so we allow it implicitly
+	const auto binary_json_type = JSONCommon::BinaryJSONType();
+	BoundCastInfo to_binary_json_info(CastToBinaryJSON, nullptr, JSONFunctionLocalState::InitCastLocalState);
+	casts.RegisterCastFunction(LogicalType::VARCHAR, binary_json_type, to_binary_json_info.Copy());
+	casts.RegisterCastFunction(LogicalType::JSON(), binary_json_type, std::move(to_binary_json_info));
+	BoundCastInfo binary_json_to_json_info(CastBinaryJSONToJSON, nullptr, JSONFunctionLocalState::InitCastLocalState);
+	casts.RegisterCastFunction(binary_json_type, LogicalType::JSON(), binary_json_to_json_info.Copy(), 1);
+	casts.RegisterCastFunction(binary_json_type, LogicalType::VARCHAR, std::move(binary_json_to_json_info));
+	// Blobs are validated when they are read
+	casts.RegisterCastFunction(LogicalType::BLOB, binary_json_type, DefaultCasts::ReinterpretCast);
+	casts.RegisterCastFunction(binary_json_type, LogicalType::BLOB, DefaultCasts::ReinterpretCast);
 }
 
 } // namespace duckdb
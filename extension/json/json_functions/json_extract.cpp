@@ -1,5 +1,17 @@
 #include "json_executors.hpp"
 
+#include "duckdb/function/function_binder.hpp"
+#include "duckdb/optimizer/optimizer.hpp"
+#include "duckdb/planner/binder.hpp"
+#include "duckdb/planner/column_binding_map.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression/bound_cast_expression.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/logical_operator_visitor.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
+
 namespace duckdb {
 
 static inline string_t ExtractFromVal(yyjson_val *val, yyjson_alc *alc, Vector &) {
@@ -42,6 +54,7 @@ ScalarFunctionSet JSONFunctions::GetExtractFunction() {
 	ScalarFunctionSet set("json_extract");
 	GetExtractFunctionsInternal(set, LogicalType::VARCHAR);
 	GetExtractFunctionsInternal(set, LogicalType::JSON());
+	GetExtractFunctionsInternal(set, JSONCommon::BinaryJSONType());
 	return set;
 }
 
@@ -60,7 +73,352 @@ ScalarFunctionSet JSONFunctions::GetExtractStringFunction() {
 	ScalarFunctionSet set("json_extract_string");
 	GetExtractStringFunctionsInternal(set, LogicalType::VARCHAR);
 	GetExtractStringFunctionsInternal(set, LogicalType::JSON());
+	GetExtractStringFunctionsInternal(set, JSONCommon::BinaryJSONType());
 	return set;
 }
 
+//! Returns "json_extract" or "json_extract_string" if the function is (an alias of) either of them, or "" otherwise
+static string GetExtractFunctionName(const string &name) {
+	if (name == "json_extract" || name == "json_extract_path") {
+		return "json_extract";
+	}
+	if (name == "json_extract_string" || name == "json_extract_path_text" || name == "->>") {
+		return "json_extract_string";
+	}
+	return string();
+}
+
+//! The json_extract/json_extract_string calls with a constant path on the same input
+struct JSONExtractGroup {
+	explicit JSONExtractGroup(const BoundFunctionExpression &call)
+	    : function_name(GetExtractFunctionName(call.function.name)) {
+		input = call.children[0]->Copy();
+	}
+
+	string function_name;
+	unique_ptr<Expression> input;
+	//! The (distinct) paths that are extracted
+	vector<string> paths;
+	//! The calls, and the index of the path they extract
+	vector<pair<reference<unique_ptr<Expression>>, idx_t>> calls;
+};
+
+//! Whether the expression is a json_extract/json_extract_string call with a single constant path without wildcards
+static bool IsConstantPathExtract(const Expression &expr) {
+	if (expr.expression_class != ExpressionClass::BOUND_FUNCTION) {
+		return false;
+	}
+	auto &func_expr = expr.Cast<BoundFunctionExpression>();
+	if (GetExtractFunctionName(func_expr.function.name).empty()) {
+		return false;
+	}
+	if (func_expr.function.bind != JSONReadFunctionData::Bind || !func_expr.bind_info) {
+		return false;
+	}
+	auto &info = func_expr.bind_info->Cast<JSONReadFunctionData>();
+	return info.constant && info.path_type == JSONCommon::JSONPathType::REGULAR;
+}
+
+static bool IsGroupableExtract(const Expression &expr) {
+	return IsConstantPathExtract(expr) && !expr.Cast<BoundFunctionExpression>().children[0]->IsVolatile();
+}
+
+static void FindExtractCalls(unique_ptr<Expression> &expr, vector<unique_ptr<JSONExtractGroup>> &groups) {
+	switch (expr->expression_class) {
+	// like the common subexpression optimizer, skip conjunctions and case, so short-circuiting is kept
+	case ExpressionClass::BOUND_CONJUNCTION:
+	case ExpressionClass::BOUND_CASE:
+		return;
+	default:
+		break;
+	}
+	if (!IsGroupableExtract(*expr)) {
+		ExpressionIterator::EnumerateChildren(
+		    *expr, [&](unique_ptr<Expression> &child) { FindExtractCalls(child, groups); });
+		return;
+	}
+	auto &func_expr = expr->Cast<BoundFunctionExpression>();
+	auto &path = func_expr.bind_info->Cast<JSONReadFunctionData>().path;
+	optional_ptr<JSONExtractGroup> group;
+	for (auto &candidate : groups) {
+		if (candidate->function_name == GetExtractFunctionName(func_expr.function.name) &&
+		    candidate->input->Equals(*func_expr.children[0])) {
+			group = candidate.get();
+			break;
+		}
+	}
+	if (!group) {
+		groups.push_back(make_uniq<JSONExtractGroup>(func_expr));
+		group = groups.back().get();
+	}
+	idx_t path_idx;
+	for (path_idx = 0; path_idx < group->paths.size(); path_idx++) {
+		if (group->paths[path_idx] == path) {
+			break;
+		}
+	}
+	if (path_idx == group->paths.size()) {
+		group->paths.push_back(path);
+	}
+	group->calls.emplace_back(expr, path_idx);
+}
+
+//! Computes the multi-path extract of the group in the projection, and replaces the calls with an element of it
+static void RewriteExtractGroup(ClientContext &context, JSONExtractGroup &group, idx_t projection_index,
+                                vector<unique_ptr<Expression>> &projections) {
+	FunctionBinder function_binder(context);
+	vector<Value> path_values;
+	for (auto &path : group.paths) {
+		path_values.emplace_back(path);
+	}
+	auto paths = Value::LIST(LogicalType::VARCHAR, std::move(path_values));
+	vector<unique_ptr<Expression>> extract_children;
+	extract_children.push_back(std::move(group.input));
+	extract_children.push_back(make_uniq<BoundConstantExpression>(std::move(paths)));
+	ErrorData error;
+	auto extract_many =
+	    function_binder.BindScalarFunction(DEFAULT_SCHEMA, group.function_name, std::move(extract_children), error);
+	if (!extract_many) {
+		error.Throw();
+	}
+	auto extract_type = extract_many->return_type;
+	auto extract_binding = ColumnBinding(projection_index, projections.size());
+	projections.push_back(std::move(extract_many));
+
+	for (auto &entry : group.calls) {
+		auto &call = entry.first.get();
+		vector<unique_ptr<Expression>> element_children;
+		element_children.push_back(make_uniq<BoundColumnRefExpression>(extract_type, extract_binding));
+		auto element_idx = Value::BIGINT(NumericCast<int64_t>(entry.second + 1));
+		element_children.push_back(make_uniq<BoundConstantExpression>(std::move(element_idx)));
+		auto element =
+		    function_binder.BindScalarFunction(DEFAULT_SCHEMA, "list_extract", std::move(element_children), error);
+		if (!element) {
+			error.Throw();
+		}
+		D_ASSERT(element->return_type == call->return_type);
+		element->alias = call->alias;
+		call = std::move(element);
+	}
+}
+
+//! Replaces the references to the columns of the child of the operator with references to the projection, which
+//! passes these columns through
+static void ReplaceColumnReferences(Expression &expr, idx_t projection_index, column_binding_map_t<idx_t> &column_map,
+                                    vector<unique_ptr<Expression>> &projections) {
+	if (expr.expression_class != ExpressionClass::BOUND_COLUMN_REF) {
+		ExpressionIterator::EnumerateChildren(expr, [&](Expression &child) {
+			ReplaceColumnReferences(child, projection_index, column_map, projections);
+		});
+		return;
+	}
+	auto &column_ref = expr.Cast<BoundColumnRefExpression>();
+	if (column_ref.binding.table_index == projection_index) {
+		// refers to a multi-path extract
+		return;
+	}
+	auto entry = column_map.find(column_ref.binding);
+	if (entry == column_map.end()) {
+		entry = column_map.emplace(column_ref.binding, projections.size()).first;
+		projections.push_back(column_ref.Copy());
+	}
+	column_ref.binding = ColumnBinding(projection_index, entry->second);
+}
+
+//! Splits a constant path that only consists of object keys into the keys, e.g., '$.a."b c"' into ["a", "b c"]
+static bool GetObjectKeys(const string &path, vector<string> &keys) {
+	D_ASSERT(!path.empty());
+	idx_t pos = 1;
+	if (path[0] == '/') {
+		// JSON pointer, we do not deal with escapes ('~0' and '~1')
+		if (path.find('~') != string::npos) {
+			return false;
+		}
+		while (pos <= path.size()) {
+			auto next = MinValue<idx_t>(path.find('/', pos), path.size());
+			keys.push_back(path.substr(pos, next - pos));
+			pos = next + 1;
+		}
+		return true;
+	}
+	D_ASSERT(path[0] == '$');
+	while (pos < path.size()) {
+		if (path[pos] != '.') {
+			// array index
+			return false;
+		}
+		pos++;
+		idx_t next;
+		if (path[pos] == '"') {
+			pos++;
+			next = path.find('"', pos);
+			keys.push_back(path.substr(pos, next - pos));
+			next++;
+		} else {
+			next = MinValue<idx_t>(path.find_first_of(".[", pos), path.size());
+			keys.push_back(path.substr(pos, next - pos));
+		}
+		pos = next;
+	}
+	return !keys.empty();
+}
+
+//! Whether to_json(x) writes values of this type exactly like extracting them from a parsed document does
+static bool IsStructExtractableType(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::BOOLEAN:
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+	case LogicalTypeId::UINTEGER:
+	case LogicalTypeId::UBIGINT:
+	case LogicalTypeId::FLOAT:
+	case LogicalTypeId::DOUBLE:
+	case LogicalTypeId::DECIMAL:
+		return true;
+	case LogicalTypeId::VARCHAR:
+		// JSON values are nested as-is by to_json
+		return !type.HasAlias();
+	case LogicalTypeId::LIST:
+		return IsStructExtractableType(ListType::GetChildType(type));
+	case LogicalTypeId::ARRAY:
+		return IsStructExtractableType(ArrayType::GetChildType(type));
+	case LogicalTypeId::STRUCT:
+		for (auto &child_type : StructType::GetChildTypes(type)) {
+			if (!IsStructExtractableType(child_type.second)) {
+				return false;
+			}
+		}
+		return true;
+	default:
+		return false;
+	}
+}
+
+//! Rewrites json_extract/json_extract_string on a STRUCT that was cast to JSON into struct_extract calls, e.g.,
+//! json_extract_string(s::JSON, '$.a.b') into s.a.b. The struct does not have to be converted to JSON and parsed
+//! anymore, and filters on the extracted field can be pushed into the scan, and use the zonemaps of the field.
+static void RewriteStructExtract(ClientContext &context, unique_ptr<Expression> &expr) {
+	ExpressionIterator::EnumerateChildren(*expr,
+	                                      [&](unique_ptr<Expression> &child) { RewriteStructExtract(context, child); });
+	if (!IsConstantPathExtract(*expr)) {
+		return;
+	}
+	auto &func_expr = expr->Cast<BoundFunctionExpression>();
+	auto &input = func_expr.children[0];
+	if (input->expression_class != ExpressionClass::BOUND_CAST) {
+		return;
+	}
+	auto &cast = input->Cast<BoundCastExpression>();
+	if (cast.try_cast || cast.child->return_type.id() != LogicalTypeId::STRUCT) {
+		return;
+	}
+	vector<string> keys;
+	if (!GetObjectKeys(func_expr.bind_info->Cast<JSONReadFunctionData>().path, keys)) {
+		return;
+	}
+	// check whether the fields exist (the keys of the document are case-sensitive)
+	reference<const LogicalType> type = cast.child->return_type;
+	for (auto &key : keys) {
+		if (type.get().id() != LogicalTypeId::STRUCT) {
+			return;
+		}
+		optional_ptr<const LogicalType> child_type;
+		for (auto &child : StructType::GetChildTypes(type.get())) {
+			if (child.first == key) {
+				child_type = &child.second;
+				break;
+			}
+		}
+		if (!child_type) {
+			return;
+		}
+		type = *child_type;
+	}
+	const bool extract_string = GetExtractFunctionName(func_expr.function.name) == "json_extract_string";
+	const bool is_varchar = type.get() == LogicalType::VARCHAR;
+	if (!IsStructExtractableType(type.get())) {
+		return;
+	}
+
+	FunctionBinder function_binder(context);
+	ErrorData error;
+	auto result = std::move(cast.child);
+	for (auto &key : keys) {
+		vector<unique_ptr<Expression>> children;
+		children.push_back(std::move(result));
+		children.push_back(make_uniq<BoundConstantExpression>(Value(key)));
+		result = function_binder.BindScalarFunction(DEFAULT_SCHEMA, "struct_extract", std::move(children), error);
+		if (!result) {
+			error.Throw();
+		}
+	}
+	// json_extract_string returns strings without quotes, everything else is returned as JSON
+	if (!extract_string || !is_varchar) {
+		vector<unique_ptr<Expression>> children;
+		children.push_back(std::move(result));
+		result = function_binder.BindScalarFunction(DEFAULT_SCHEMA, "to_json", std::move(children), error);
+		if (!result) {
+			error.Throw();
+		}
+		if (extract_string) {
+			result = BoundCastExpression::AddCastToType(context, std::move(result), LogicalType::VARCHAR);
+		}
+	}
+	D_ASSERT(result->return_type == expr->return_type);
+	result->alias = expr->alias;
+	expr = std::move(result);
+}
+
+static void GroupExtractFunctions(Optimizer &optimizer, unique_ptr<LogicalOperator> &plan) {
+	for (auto &child : plan->children) {
+		GroupExtractFunctions(optimizer, child);
+	}
+	if (plan->type != LogicalOperatorType::LOGICAL_PROJECTION &&
+	    plan->type != LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY) {
+		return;
+	}
+	vector<unique_ptr<JSONExtractGroup>> groups;
+	LogicalOperatorVisitor::EnumerateExpressions(
+	    *plan, [&](unique_ptr<Expression> *child) { FindExtractCalls(*child, groups); });
+	bool has_multi_path_group = false;
+	for (auto &group : groups) {
+		has_multi_path_group = has_multi_path_group || group->paths.size() > 1;
+	}
+	if (!has_multi_path_group) {
+		return;
+	}
+	// compute the multi-path extracts in a projection below the operator, so each document is parsed once per row
+	auto projection_index = optimizer.binder.GenerateTableIndex();
+	vector<unique_ptr<Expression>> projections;
+	for (auto &group : groups) {
+		if (group->paths.size() > 1) {
+			RewriteExtractGroup(optimizer.context, *group, projection_index, projections);
+		}
+	}
+	column_binding_map_t<idx_t> column_map;
+	LogicalOperatorVisitor::EnumerateExpressions(*plan, [&](unique_ptr<Expression> *child) {
+		ReplaceColumnReferences(**child, projection_index, column_map, projections);
+	});
+	auto projection = make_uniq<LogicalProjection>(projection_index, std::move(projections));
+	projection->children.push_back(std::move(plan->children[0]));
+	plan->children[0] = std::move(projection);
+}
+
+static void RewriteStructExtracts(ClientContext &context, LogicalOperator &op) {
+	for (auto &child : op.children) {
+		RewriteStructExtracts(context, *child);
+	}
+	LogicalOperatorVisitor::EnumerateExpressions(
+	    op, [&](unique_ptr<Expression> *child) { RewriteStructExtract(context, *child); });
+}
+
+void JSONFunctions::OptimizeExtractFunctions(OptimizerExtensionInput &input, unique_ptr<LogicalOperator> &plan) {
+	RewriteStructExtracts(input.context, *plan);
+	GroupExtractFunctions(input.optimizer, plan);
+}
+
 } // namespace duckdb
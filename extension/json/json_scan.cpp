@@ -1,9 +1,11 @@
 #include "json_scan.hpp"
 
+#include "duckdb/common/bit_utils.hpp"
 #include "duckdb/common/enum_util.hpp"
 #include "duckdb/common/multi_file_reader.hpp"
 #include "duckdb/common/serializer/deserializer.hpp"
 #include "duckdb/common/serializer/serializer.hpp"
+#include "duckdb/execution/executor.hpp"
 #include "duckdb/main/extension_helper.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
@@ -146,8 +148,8 @@ JSONScanGlobalState::JSONScanGlobalState(ClientContext &context, const JSONScanD
 
 JSONScanLocalState::JSONScanLocalState(ClientContext &context, JSONScanGlobalState &gstate)
     : scan_count(0), batch_index(DConstants::INVALID_INDEX), total_read_size(0), total_tuple_count(0),
-      bind_data(gstate.bind_data), allocator(BufferAllocator::Get(context)), is_last(false),
-      fs(FileSystem::GetFileSystem(context)), buffer_size(0), buffer_offset(0), prev_buffer_remainder(0) {
+      context(context), bind_data(gstate.bind_data), allocator(BufferAllocator::Get(context)), is_last(false),
+      fs(FileSystem::GetFileSystem(context)), buffer_size(0), buffer_offset(0) {
 }
 
 JSONGlobalTableFunctionState::JSONGlobalTableFunctionState(ClientContext &context, TableFunctionInitInput &input)
@@ -212,23 +214,18 @@ unique_ptr<GlobalTableFunctionState> JSONGlobalTableFunctionState::Init(ClientCo
 idx_t JSONGlobalTableFunctionState::MaxThreads() const {
 	auto &bind_data = state.bind_data;
 
-	if (!state.json_readers.empty() && state.json_readers[0]->HasFileHandle()) {
-		// We opened and auto-detected a file, so we can get a better estimate
-		auto &reader = *state.json_readers[0];
-		if (bind_data.options.format == JSONFormat::NEWLINE_DELIMITED ||
-		    reader.GetFormat() == JSONFormat::NEWLINE_DELIMITED) {
-			return MaxValue<idx_t>(state.json_readers[0]->GetFileHandle().FileSize() / bind_data.maximum_object_size,
-			                       1);
-		}
+	if (!state.enable_parallel_scans) {
+		// One reader per file
+		return bind_data.files.size();
 	}
 
-	if (bind_data.options.format == JSONFormat::NEWLINE_DELIMITED) {
-		// We haven't opened any files, so this is our best bet
-		return state.system_threads;
+	if (!state.json_readers.empty() && state.json_readers[0]->HasFileHandle()) {
+		// We opened and auto-detected a file, so we can get a better estimate
+		return MaxValue<idx_t>(state.json_readers[0]->GetFileHandle().FileSize() / bind_data.maximum_object_size, 1);
 	}
 
-	// One reader per file
-	return bind_data.files.size();
+	// We haven't opened any files, so this is our best bet
+	return state.system_threads;
 }
 
 JSONLocalTableFunctionState::JSONLocalTableFunctionState(ClientContext &context, JSONScanGlobalState &gstate)
@@ -271,11 +268,16 @@ idx_t JSONScanLocalState::ReadNext(JSONScanGlobalState &gstate) {
 			if (!ReadNextBuffer(gstate)) {
 				break;
 			}
-			if (current_buffer_handle->buffer_index != 0 &&
-			    current_reader->GetFormat() == JSONFormat::NEWLINE_DELIMITED) {
-				if (ReconstructFirstObject(gstate)) {
+			if (current_reader->GetFormat() == JSONFormat::NEWLINE_DELIMITED) {
+				if (current_buffer_handle->buffer_index != 0 && ReconstructFirstObject(gstate)) {
 					scan_count++;
 				}
+			} else if (current_buffer_handle->buffer_index != 0) {
+				if (ReconstructFirstValue(gstate)) {
+					scan_count++;
+				}
+			} else {
+				SplitOffRemainder();
 			}
 		}
 
@@ -299,6 +301,22 @@ static inline const char *PreviousNewline(const char *ptr, const idx_t size) {
 	return ptr;
 }
 
+//! Skips over the contents of a string a word at a time, up to the first quote or backslash
+//! The bytes that do not fill up a word before the end are left to the caller
+static inline const char *SkipStringContents(const char *ptr, const char *const end) {
+	static constexpr uint64_t QUOTES = SWAR::Broadcast('"');
+	static constexpr uint64_t BACKSLASHES = SWAR::Broadcast('\\');
+	while (ptr + sizeof(uint64_t) <= end) {
+		const auto word = Load<uint64_t>(const_data_ptr_cast(ptr));
+		const auto mask = SWAR::ZeroByteMask(word ^ QUOTES) | SWAR::ZeroByteMask(word ^ BACKSLASHES);
+		if (mask) {
+			return ptr + SWAR::FirstFlaggedByte(mask);
+		}
+		ptr += sizeof(uint64_t);
+	}
+	return ptr;
+}
+
 static inline const char *NextJSONDefault(const char *ptr, const char *const end) {
 	idx_t parents = 0;
 	while (ptr != end) {
@@ -313,6 +331,10 @@ static inline const char *NextJSONDefault(const char *ptr, const char *const end
 			break;
 		case '"':
 			while (ptr != end) {
+				ptr = SkipStringContents(ptr, end);
+				if (ptr == end) {
+					break;
+				}
 				auto string_char = *ptr++;
 				if (string_char == '"') {
 					break;
@@ -440,8 +462,10 @@ bool JSONScanLocalState::IsParallel(JSONScanGlobalState &gstate) const {
 		return false; // More files than threads, just parallelize over the files
 	}
 
-	// NDJSON can be read in parallel
-	return current_reader->GetFormat() == JSONFormat::NEWLINE_DELIMITED;
+	// The buffers of a file can be read in parallel. For NDJSON, each reader finds the line that continues in the next
+	// buffer by itself. For other formats, the reader of the next buffer waits until we have found the value that
+	// continues in it, which we do before parsing
+	return true;
 }
 
 static pair<JSONFormat, JSONRecordType> DetectFormatAndRecordType(char *const buffer_ptr, const idx_t buffer_size,
@@ -537,14 +561,6 @@ bool JSONScanLocalState::ReadNextBuffer(JSONScanGlobalState &gstate) {
 		}
 	}
 
-	// Copy last bit of previous buffer
-	if (current_reader && current_reader->GetFormat() != JSONFormat::NEWLINE_DELIMITED && !is_last) {
-		if (!buffer.IsSet()) {
-			buffer = AllocateBuffer(gstate);
-		}
-		memcpy(buffer_ptr, GetReconstructBuffer(gstate), prev_buffer_remainder);
-	}
-
 	optional_idx buffer_index;
 	while (true) {
 		// Continue with the current reader
@@ -628,10 +644,8 @@ bool JSONScanLocalState::ReadNextBuffer(JSONScanGlobalState &gstate) {
 	}
 	D_ASSERT(buffer_index.IsValid());
 
-	idx_t readers = 1;
-	if (current_reader->GetFormat() == JSONFormat::NEWLINE_DELIMITED) {
-		readers = is_last ? 1 : 2;
-	}
+	// The reader of the next buffer reconstructs the value that continues in it
+	idx_t readers = is_last ? 1 : 2;
 
 	// Create an entry and insert it into the map
 	auto json_buffer_handle =
@@ -639,7 +653,6 @@ bool JSONScanLocalState::ReadNextBuffer(JSONScanGlobalState &gstate) {
 	current_buffer_handle = json_buffer_handle.get();
 	current_reader->InsertBuffer(buffer_index.GetIndex(), std::move(json_buffer_handle));
 
-	prev_buffer_remainder = 0;
 	lines_or_objects_in_buffer = 0;
 
 	// YYJSON needs this
@@ -698,7 +711,7 @@ bool JSONScanLocalState::ReadNextBufferSeek(JSONScanGlobalState &gstate, Allocat
                                             optional_idx &buffer_index, bool &file_done) {
 	auto &file_handle = current_reader->GetFileHandle();
 
-	idx_t request_size = gstate.buffer_capacity - prev_buffer_remainder - YYJSON_PADDING_SIZE;
+	idx_t request_size = gstate.buffer_capacity - YYJSON_PADDING_SIZE;
 	idx_t read_position;
 	idx_t read_size;
 
@@ -716,11 +729,9 @@ bool JSONScanLocalState::ReadNextBufferSeek(JSONScanGlobalState &gstate, Allocat
 		buffer_index = current_reader->GetBufferIndex();
 		is_last = read_size == 0;
 
-		if (current_reader->GetFormat() == JSONFormat::NEWLINE_DELIMITED) {
-			batch_index = gstate.batch_index++;
-		}
+		batch_index = gstate.batch_index++;
 	}
-	buffer_size = prev_buffer_remainder + read_size;
+	buffer_size = read_size;
 
 	if (read_size != 0) {
 		auto &raw_handle = file_handle.GetHandle();
@@ -737,7 +748,7 @@ bool JSONScanLocalState::ReadNextBufferSeek(JSONScanGlobalState &gstate, Allocat
 	}
 
 	// Now read the file lock-free!
-	file_handle.ReadAtPosition(buffer_ptr + prev_buffer_remainder, read_size, read_position, file_done,
+	file_handle.ReadAtPosition(buffer_ptr, read_size, read_position, file_done,
 	                           gstate.bind_data.type == JSONScanType::SAMPLE, thread_local_filehandle);
 
 	return true;
@@ -745,7 +756,7 @@ bool JSONScanLocalState::ReadNextBufferSeek(JSONScanGlobalState &gstate, Allocat
 
 bool JSONScanLocalState::ReadNextBufferNoSeek(JSONScanGlobalState &gstate, AllocatedData &buffer,
                                               optional_idx &buffer_index, bool &file_done) {
-	idx_t request_size = gstate.buffer_capacity - prev_buffer_remainder - YYJSON_PADDING_SIZE;
+	idx_t request_size = gstate.buffer_capacity - YYJSON_PADDING_SIZE;
 	idx_t read_size;
 
 	{
@@ -760,18 +771,16 @@ bool JSONScanLocalState::ReadNextBufferNoSeek(JSONScanGlobalState &gstate, Alloc
 		if (!buffer.IsSet()) {
 			buffer = AllocateBuffer(gstate);
 		}
-		if (!file_handle.Read(buffer_ptr + prev_buffer_remainder, read_size, request_size, file_done,
+		if (!file_handle.Read(buffer_ptr, read_size, request_size, file_done,
 		                      gstate.bind_data.type == JSONScanType::SAMPLE)) {
 			return false; // Couldn't read anything
 		}
 		buffer_index = current_reader->GetBufferIndex();
 		is_last = read_size == 0;
 
-		if (current_reader->GetFormat() == JSONFormat::NEWLINE_DELIMITED) {
-			batch_index = gstate.batch_index++;
-		}
+		batch_index = gstate.batch_index++;
 	}
-	buffer_size = prev_buffer_remainder + read_size;
+	buffer_size = read_size;
 
 	return true;
 }
@@ -818,15 +827,29 @@ void JSONScanLocalState::SkipOverArrayStart() {
 	}
 }
 
+JSONBufferHandle &JSONScanLocalState::WaitForPreviousBuffer() {
+	D_ASSERT(current_buffer_handle->buffer_index != 0);
+	const auto wait_for_remainder = current_reader->GetFormat() != JSONFormat::NEWLINE_DELIMITED;
+	// Spin (yielding the thread) until the previous batch index has also read its buffer (and split off its remainder)
+	while (true) {
+		auto previous_buffer_handle = current_reader->GetBuffer(current_buffer_handle->buffer_index - 1);
+		if (previous_buffer_handle &&
+		    (!wait_for_remainder || previous_buffer_handle->remainder_offset != DConstants::INVALID_INDEX)) {
+			return *previous_buffer_handle;
+		}
+		if (Executor::Get(context).HasError()) {
+			// The reader of the previous buffer ran into an error, and will not get there
+			throw InterruptException();
+		}
+		TaskScheduler::YieldThread();
+	}
+}
+
 bool JSONScanLocalState::ReconstructFirstObject(JSONScanGlobalState &gstate) {
 	D_ASSERT(current_buffer_handle->buffer_index != 0);
 	D_ASSERT(current_reader->GetFormat() == JSONFormat::NEWLINE_DELIMITED);
 
-	// Spinlock until the previous batch index has also read its buffer
-	optional_ptr<JSONBufferHandle> previous_buffer_handle;
-	while (!previous_buffer_handle) {
-		previous_buffer_handle = current_reader->GetBuffer(current_buffer_handle->buffer_index - 1);
-	}
+	auto previous_buffer_handle = &WaitForPreviousBuffer();
 
 	// First we find the newline in the previous block
 	auto prev_buffer_ptr = char_ptr_cast(previous_buffer_handle->buffer.get()) + previous_buffer_handle->buffer_size;
@@ -874,6 +897,101 @@ bool JSONScanLocalState::ReconstructFirstObject(JSONScanGlobalState &gstate) {
 	return true;
 }
 
+void JSONScanLocalState::SplitOffRemainder() {
+	D_ASSERT(current_reader->GetFormat() != JSONFormat::NEWLINE_DELIMITED);
+	// Find the boundaries of the values in the buffer without parsing them, up to the value that continues in the next
+	// buffer. The reader of the next buffer can start as soon as we are done, so both buffers can be parsed in parallel
+	const auto format = current_reader->GetFormat();
+	idx_t offset = buffer_offset;
+	idx_t remainder_offset;
+	while (true) {
+		SkipWhitespace(buffer_ptr, offset, buffer_size);
+		remainder_offset = offset;
+		if (offset == buffer_size) {
+			break;
+		}
+		auto json_end = NextJSON(buffer_ptr + offset, buffer_size - offset);
+		if (json_end == nullptr) {
+			break; // Value continues in the next buffer
+		}
+		offset = json_end - buffer_ptr;
+		if (format == JSONFormat::ARRAY) {
+			SkipWhitespace(buffer_ptr, offset, buffer_size);
+			if (offset == buffer_size || (buffer_ptr[offset] != ',' && buffer_ptr[offset] != ']')) {
+				// The separator is in the next buffer, or there is an error, which is thrown by the next reader
+				break;
+			}
+			offset++;
+		}
+	}
+	current_buffer_handle->remainder_offset = remainder_offset;
+	// The values from the remainder onwards are parsed by the reader of the next buffer
+	buffer_size = remainder_offset;
+}
+
+bool JSONScanLocalState::ReconstructFirstValue(JSONScanGlobalState &gstate) {
+	D_ASSERT(current_buffer_handle->buffer_index != 0);
+	D_ASSERT(current_reader->GetFormat() != JSONFormat::NEWLINE_DELIMITED);
+
+	// Copy the value that started in the previous buffer to our reconstruct buffer
+	auto &previous_buffer_handle = WaitForPreviousBuffer();
+	const auto part1_offset = previous_buffer_handle.remainder_offset.load();
+	const auto part1_ptr = char_ptr_cast(previous_buffer_handle.buffer.get()) + part1_offset;
+	const auto part1_size = previous_buffer_handle.buffer_size - part1_offset;
+	if (part1_size > bind_data.maximum_object_size) {
+		ThrowObjectSizeError(part1_size);
+	}
+	const auto reconstruct_ptr = char_ptr_cast(GetReconstructBuffer(gstate));
+	memcpy(reconstruct_ptr, part1_ptr, part1_size);
+
+	// We copied the value, so we are no longer reading the previous buffer
+	if (--previous_buffer_handle.readers == 0) {
+		current_reader->RemoveBuffer(previous_buffer_handle);
+	}
+
+	if (part1_size == 0) {
+		SplitOffRemainder();
+		return false;
+	}
+
+	// The value has to fit within the maximum object size, so we only need to copy the start of our buffer
+	const auto part2_max = MinValue<idx_t>(buffer_size, bind_data.maximum_object_size - part1_size + 1);
+	memcpy(reconstruct_ptr + part1_size, buffer_ptr, part2_max);
+	const auto reconstruct_size = part1_size + part2_max;
+	memset(reconstruct_ptr + reconstruct_size, 0, YYJSON_PADDING_SIZE);
+
+	auto json_end = NextJSON(reconstruct_ptr, reconstruct_size);
+	if (json_end == nullptr) {
+		if (part2_max != buffer_size) {
+			ThrowObjectSizeError(reconstruct_size);
+		}
+		// We copied the whole buffer, which is not full, so this is the last value of the file
+		json_end = reconstruct_ptr + reconstruct_size;
+	}
+	const idx_t json_size = json_end - reconstruct_ptr;
+	if (json_size > part1_size) {
+		buffer_offset += json_size - part1_size;
+	}
+	if (current_reader->GetFormat() == JSONFormat::ARRAY) {
+		SkipWhitespace(buffer_ptr, buffer_offset, buffer_size);
+		if (buffer_ptr[buffer_offset] == ',' || buffer_ptr[buffer_offset] == ']') {
+			buffer_offset++;
+		} else { // We can't ignore this error, even with 'ignore_errors'
+			yyjson_read_err err;
+			err.code = YYJSON_READ_ERROR_UNEXPECTED_CHARACTER;
+			err.msg = "unexpected character";
+			err.pos = json_size;
+			current_reader->ThrowParseError(current_buffer_handle->buffer_index, lines_or_objects_in_buffer, err);
+		}
+	}
+
+	// Let the reader of the next buffer start before we parse
+	SplitOffRemainder();
+	ParseJSON(reconstruct_ptr, json_size, reconstruct_size);
+
+	return true;
+}
+
 void JSONScanLocalState::ParseNextChunk(JSONScanGlobalState &gstate) {
 	auto buffer_offset_before = buffer_offset;
 
@@ -890,18 +1008,12 @@ void JSONScanLocalState::ParseNextChunk(JSONScanGlobalState &gstate) {
 		                                                               : NextJSON(json_start, remaining);
 		if (json_end == nullptr) {
 			// We reached the end of the buffer
-			if (!is_last) {
+			if (!is_last && format == JSONFormat::NEWLINE_DELIMITED) {
 				// Last bit of data belongs to the next batch
-				if (format != JSONFormat::NEWLINE_DELIMITED) {
-					if (remaining > bind_data.maximum_object_size) {
-						ThrowObjectSizeError(remaining);
-					}
-					memcpy(GetReconstructBuffer(gstate), json_start, remaining);
-					prev_buffer_remainder = remaining;
-				}
 				buffer_offset = buffer_size;
 				break;
 			}
+			// For the other formats, the value that continues in the next buffer was already split off
 			json_end = json_start + remaining;
 		}
 
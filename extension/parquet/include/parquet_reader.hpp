@@ -120,7 +120,7 @@ public:
 	vector<duckdb_parquet::format::SchemaElement> generated_column_schema;
 
 public:
-	void InitializeScan(ParquetReaderScanState &state, vector<idx_t> groups_to_read);
+	void InitializeScan(ClientContext &context, ParquetReaderScanState &state, vector<idx_t> groups_to_read);
 	void Scan(ParquetReaderScanState &state, DataChunk &output);
 
 	idx_t NumRows();
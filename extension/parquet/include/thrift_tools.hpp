@@ -7,8 +7,17 @@
 #ifndef DUCKDB_AMALGAMATION
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/allocator.hpp"
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/thread.hpp"
+#include "duckdb/storage/object_cache.hpp"
 #endif
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+
 namespace duckdb {
 
 // A ReadHead for prefetching data in a specific range
@@ -20,7 +29,12 @@ struct ReadHead {
 
 	// Current info
 	AllocatedData data;
+	// Whether the data has been read, or is being read by the prefetch pool
 	bool data_isset = false;
+	// The number of parts of this read head that have not been read yet
+	atomic<idx_t> pending_parts {0};
+	// The error thrown while reading one of the parts, set before pending_parts is decremented
+	std::exception_ptr error;
 
 	idx_t GetEnd() const {
 		return size + location;
@@ -31,27 +45,230 @@ struct ReadHead {
 	}
 };
 
-// Comparator for ReadHeads that are either overlapping, adjacent, or within ALLOW_GAP bytes from each other
+// Comparator for ReadHeads that are either overlapping, adjacent, or within allow_gap bytes from each other
 struct ReadHeadComparator {
-	static constexpr uint64_t ALLOW_GAP = 1 << 14; // 16 KiB
+	explicit ReadHeadComparator(uint64_t allow_gap) : allow_gap(allow_gap) {
+	}
+	uint64_t allow_gap;
+
 	bool operator()(const ReadHead *a, const ReadHead *b) const {
 		auto a_start = a->location;
 		auto a_end = a->location + a->size;
 		auto b_start = b->location;
 
-		if (a_end <= NumericLimits<idx_t>::Maximum() - ALLOW_GAP) {
-			a_end += ALLOW_GAP;
+		if (a_end <= NumericLimits<idx_t>::Maximum() - allow_gap) {
+			a_end += allow_gap;
 		}
 
 		return a_start < b_start && a_end < b_start;
 	}
 };
 
+// Measured performance of the reads, used to decide how far apart two ranges can be before it is cheaper to read them
+// with separate requests than to read the gap between them: reading the gap takes gap / bandwidth, while another
+// request takes (roughly) one latency. So ranges are merged when the gap is smaller than latency * bandwidth.
+struct ReadStatistics {
+	static constexpr uint64_t MIN_GAP = 1 << 14; // 16 KiB
+	static constexpr uint64_t MAX_GAP = 1 << 25; // 32 MiB
+
+	// The fastest read, an upper bound of the latency
+	double min_seconds = NumericLimits<double>::Maximum();
+	// The highest throughput of a single read, a lower bound of the bandwidth
+	double max_bytes_per_second = 0;
+
+	void AddRead(uint64_t size, double seconds) {
+		if (seconds <= 0) {
+			return;
+		}
+		min_seconds = MinValue<double>(min_seconds, seconds);
+		max_bytes_per_second = MaxValue<double>(max_bytes_per_second, double(size) / seconds);
+	}
+
+	uint64_t AllowedGap() const {
+		if (max_bytes_per_second == 0) {
+			return MIN_GAP;
+		}
+		auto gap = min_seconds * max_bytes_per_second;
+		if (gap >= double(MAX_GAP)) {
+			return MAX_GAP;
+		}
+		return MaxValue<uint64_t>(MIN_GAP, uint64_t(gap));
+	}
+};
+
+// A part of a read head that is read by a single read
+struct PrefetchPart {
+	ReadHead *read_head;
+	uint64_t offset;
+	uint64_t size;
+};
+
+// The prefetches of a read ahead buffer that are in progress, shared with the threads of the prefetch pool
+struct PrefetchState {
+	explicit PrefetchState(FileHandle &handle) : handle(handle) {
+	}
+
+	FileHandle &handle;
+	mutex lock;
+	std::condition_variable prefetch_done;
+	ReadStatistics statistics;
+	// The parts that have not been read yet
+	std::deque<PrefetchPart> parts;
+	// The number of parts that are being read
+	idx_t active_reads = 0;
+
+	void ReadPart(ReadHead &read_head, uint64_t offset, uint64_t size) {
+		auto start = std::chrono::steady_clock::now();
+		handle.Read(read_head.data.get() + offset, size, read_head.location + offset);
+		auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		lock_guard<mutex> guard(lock);
+		statistics.AddRead(size, seconds);
+	}
+
+	// Reads the parts until none are left
+	void ReadParts() {
+		std::unique_lock<mutex> guard(lock);
+		while (!parts.empty()) {
+			auto part = parts.front();
+			parts.pop_front();
+			ReadPendingPart(guard, part);
+		}
+	}
+
+	// Waits until all parts of the read head have been read. Parts that no thread has started reading yet are read by
+	// the waiting thread, so it never depends on the prefetch pool having a thread available.
+	void WaitForReadHead(ReadHead &read_head) {
+		std::unique_lock<mutex> guard(lock);
+		while (read_head.pending_parts != 0) {
+			auto entry = std::find_if(parts.begin(), parts.end(),
+			                          [&](const PrefetchPart &part) { return part.read_head == &read_head; });
+			if (entry == parts.end()) {
+				prefetch_done.wait(guard);
+				continue;
+			}
+			auto part = *entry;
+			parts.erase(entry);
+			ReadPendingPart(guard, part);
+		}
+	}
+
+	// Drops the parts that have not been read yet, and waits for the reads that are in progress
+	void Cancel() {
+		std::unique_lock<mutex> guard(lock);
+		parts.clear();
+		prefetch_done.wait(guard, [&]() { return active_reads == 0; });
+	}
+
+private:
+	void ReadPendingPart(std::unique_lock<mutex> &guard, const PrefetchPart &part) {
+		auto &read_head = *part.read_head;
+		active_reads++;
+		guard.unlock();
+		std::exception_ptr error;
+		try {
+			ReadPart(read_head, part.offset, part.size);
+		} catch (...) {
+			error = std::current_exception();
+		}
+		guard.lock();
+		if (error && !read_head.error) {
+			read_head.error = error;
+		}
+		read_head.pending_parts--;
+		active_reads--;
+		prefetch_done.notify_all();
+	}
+};
+
+// A bounded pool of threads that read the prefetched parts of all parquet readers of a database. The reads mostly wait
+// for the network rather than use the CPU, so they are not run as tasks of the scheduler, whose threads are busy with
+// the scan itself.
+class ParquetPrefetchPool : public ObjectCacheEntry {
+public:
+	// The maximum number of threads of the pool, i.e. of reads that are in flight at the same time
+	static constexpr idx_t MAX_THREADS = 16;
+
+	~ParquetPrefetchPool() override {
+		{
+			lock_guard<mutex> guard(lock);
+			shutdown = true;
+		}
+		work_available.notify_all();
+		for (auto &worker : workers) {
+			worker.join();
+		}
+	}
+
+	static shared_ptr<ParquetPrefetchPool> Get(ClientContext &context) {
+		return ObjectCache::GetObjectCache(context).GetOrCreate<ParquetPrefetchPool>(ObjectType());
+	}
+
+	// Lets up to thread_count threads read the parts of the prefetch state
+	void Schedule(const shared_ptr<PrefetchState> &state, idx_t thread_count) {
+#ifndef DUCKDB_NO_THREADS
+		{
+			lock_guard<mutex> guard(lock);
+			for (idx_t i = 0; i < thread_count; i++) {
+				queue.push_back(state);
+			}
+			while (workers.size() < MAX_THREADS && idle_workers < queue.size()) {
+				idle_workers++;
+				workers.emplace_back([this]() { Work(); });
+			}
+		}
+		work_available.notify_all();
+#endif
+	}
+
+	static string ObjectType() {
+		return "parquet_prefetch_pool";
+	}
+
+	string GetObjectType() override {
+		return ObjectType();
+	}
+
+private:
+	void Work() {
+		std::unique_lock<mutex> guard(lock);
+		while (true) {
+			work_available.wait(guard, [&]() { return shutdown || !queue.empty(); });
+			if (shutdown) {
+				return;
+			}
+			auto state = std::move(queue.front());
+			queue.pop_front();
+			idle_workers--;
+			guard.unlock();
+			state->ReadParts();
+			state.reset();
+			guard.lock();
+			idle_workers++;
+		}
+	}
+
+private:
+	mutex lock;
+	std::condition_variable work_available;
+	std::deque<shared_ptr<PrefetchState>> queue;
+	vector<thread> workers;
+	idx_t idle_workers = 0;
+	bool shutdown = false;
+};
+
 // Two-step read ahead buffer
 // 1: register all ranges that will be read, merging ranges that are consecutive
-// 2: prefetch all registered ranges
+// 2: prefetch all registered ranges, reading them concurrently if a prefetch pool is available
 struct ReadAheadBuffer {
-	ReadAheadBuffer(Allocator &allocator, FileHandle &handle) : allocator(allocator), handle(handle) {
+	// Read heads are read in parts of at most this size, so that large read heads are read concurrently as well
+	static constexpr uint64_t READ_PART_SIZE = 1 << 23; // 8 MiB
+
+	ReadAheadBuffer(Allocator &allocator, FileHandle &handle, shared_ptr<ParquetPrefetchPool> pool)
+	    : merge_set(ReadHeadComparator(ReadStatistics::MIN_GAP)), allocator(allocator), handle(handle),
+	      pool(std::move(pool)), state(make_shared_ptr<PrefetchState>(handle)) {
+	}
+	~ReadAheadBuffer() {
+		state->Cancel();
 	}
 
 	// The list of read heads
@@ -80,7 +297,7 @@ struct ReadAheadBuffer {
 			}
 		}
 
-		read_heads.emplace_front(ReadHead(pos, len));
+		read_heads.emplace_front(pos, len);
 		total_size += len;
 		auto &read_head = read_heads.front();
 
@@ -103,27 +320,85 @@ struct ReadAheadBuffer {
 		return nullptr;
 	}
 
-	// Prefetch all read heads
+	// Read a read head that was not prefetched
+	void Read(ReadHead &read_head) {
+		read_head.Allocate(allocator);
+		state->ReadPart(read_head, 0, read_head.size);
+		read_head.data_isset = true;
+	}
+
+	// Prefetch all read heads that have not been read yet. The reads are done by the threads of the prefetch pool,
+	// WaitForReadHead has to be called before the data of a read head is used.
 	void Prefetch() {
+		vector<PrefetchPart> parts;
 		for (auto &read_head : read_heads) {
-			read_head.Allocate(allocator);
-
+			if (read_head.data_isset) {
+				continue;
+			}
 			if (read_head.GetEnd() > handle.GetFileSize()) {
 				throw std::runtime_error("Prefetch registered requested for bytes outside file");
 			}
-
-			handle.Read(read_head.data.get(), read_head.size, read_head.location);
+			read_head.Allocate(allocator);
 			read_head.data_isset = true;
+			idx_t part_count = 0;
+			for (uint64_t offset = 0; offset < read_head.size; offset += READ_PART_SIZE) {
+				parts.push_back({&read_head, offset, MinValue<uint64_t>(READ_PART_SIZE, read_head.size - offset)});
+				part_count++;
+			}
+			read_head.pending_parts = part_count;
+		}
+		if (pool && parts.size() > 1) {
+			{
+				lock_guard<mutex> guard(state->lock);
+				for (auto &part : parts) {
+					state->parts.push_back(part);
+				}
+			}
+			pool->Schedule(state, MinValue<idx_t>(parts.size(), ParquetPrefetchPool::MAX_THREADS));
+			return;
+		}
+		for (auto &part : parts) {
+			part.read_head->pending_parts = 0;
+			state->ReadPart(*part.read_head, part.offset, part.size);
 		}
 	}
+
+	// Waits until the read head has been read
+	void WaitForReadHead(ReadHead &read_head) {
+		if (read_head.pending_parts != 0) {
+			state->WaitForReadHead(read_head);
+		}
+		if (read_head.error) {
+			std::rethrow_exception(read_head.error);
+		}
+	}
+
+	// Removes all read heads, waiting for the prefetches that are still reading
+	void Clear() {
+		state->Cancel();
+		read_heads.clear();
+		ResetMergeSet();
+	}
+
+	// Clears the merge set, taking the reads so far into account for merging the next registered ranges
+	void ResetMergeSet() {
+		lock_guard<mutex> guard(state->lock);
+		merge_set = std::set<ReadHead *, ReadHeadComparator>(ReadHeadComparator(state->statistics.AllowedGap()));
+	}
+
+private:
+	// The pool that reads the prefetched parts, if the handle supports concurrent positional reads
+	shared_ptr<ParquetPrefetchPool> pool;
+	shared_ptr<PrefetchState> state;
 };
 
 class ThriftFileTransport : public duckdb_apache::thrift::transport::TVirtualTransport<ThriftFileTransport> {
 public:
 	static constexpr uint64_t PREFETCH_FALLBACK_BUFFERSIZE = 1000000;
 
-	ThriftFileTransport(Allocator &allocator, FileHandle &handle_p, bool prefetch_mode_p)
-	    : handle(handle_p), location(0), allocator(allocator), ra_buffer(ReadAheadBuffer(allocator, handle_p)),
+	ThriftFileTransport(Allocator &allocator, FileHandle &handle_p, bool prefetch_mode_p,
+	                    shared_ptr<ParquetPrefetchPool> prefetch_pool = nullptr)
+	    : handle(handle_p), location(0), allocator(allocator), ra_buffer(allocator, handle_p, std::move(prefetch_pool)),
 	      prefetch_mode(prefetch_mode_p) {
 	}
 
@@ -133,15 +408,16 @@ public:
 			D_ASSERT(location - prefetch_buffer->location + len <= prefetch_buffer->size);
 
 			if (!prefetch_buffer->data_isset) {
-				prefetch_buffer->Allocate(allocator);
-				handle.Read(prefetch_buffer->data.get(), prefetch_buffer->size, prefetch_buffer->location);
-				prefetch_buffer->data_isset = true;
+				ra_buffer.Read(*prefetch_buffer);
+			} else {
+				ra_buffer.WaitForReadHead(*prefetch_buffer);
 			}
 			memcpy(buf, prefetch_buffer->data.get() + location - prefetch_buffer->location, len);
 		} else {
 			if (prefetch_mode && len < PREFETCH_FALLBACK_BUFFERSIZE && len > 0) {
 				Prefetch(location, MinValue<uint64_t>(PREFETCH_FALLBACK_BUFFERSIZE, handle.GetFileSize() - location));
 				auto prefetch_buffer_fallback = ra_buffer.GetReadHead(location);
+				ra_buffer.WaitForReadHead(*prefetch_buffer_fallback);
 				D_ASSERT(location - prefetch_buffer_fallback->location + len <= prefetch_buffer_fallback->size);
 				memcpy(buf, prefetch_buffer_fallback->data.get() + location - prefetch_buffer_fallback->location, len);
 			} else {
@@ -166,7 +442,7 @@ public:
 
 	// Prevents any further merges, should be called before PrefetchRegistered
 	void FinalizeRegistration() {
-		ra_buffer.merge_set.clear();
+		ra_buffer.ResetMergeSet();
 	}
 
 	// Prefetch all previously registered ranges
@@ -175,8 +451,7 @@ public:
 	}
 
 	void ClearPrefetch() {
-		ra_buffer.read_heads.clear();
-		ra_buffer.merge_set.clear();
+		ra_buffer.Clear();
 	}
 
 	void SetLocation(idx_t location_p) {
@@ -25,6 +25,7 @@
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
 #include "duckdb/planner/filter/null_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
@@ -49,8 +50,10 @@ using duckdb_parquet::format::Statistics;
 using duckdb_parquet::format::Type;
 
 static unique_ptr<duckdb_apache::thrift::protocol::TProtocol>
-CreateThriftFileProtocol(Allocator &allocator, FileHandle &file_handle, bool prefetch_mode) {
-	auto transport = std::make_shared<ThriftFileTransport>(allocator, file_handle, prefetch_mode);
+CreateThriftFileProtocol(Allocator &allocator, FileHandle &file_handle, bool prefetch_mode,
+                         shared_ptr<ParquetPrefetchPool> prefetch_pool = nullptr) {
+	auto transport =
+	    std::make_shared<ThriftFileTransport>(allocator, file_handle, prefetch_mode, std::move(prefetch_pool));
 	return make_uniq<duckdb_apache::thrift::protocol::TCompactProtocolT<ThriftFileTransport>>(std::move(transport));
 }
 
@@ -680,7 +683,8 @@ idx_t ParquetReader::NumRowGroups() {
 	return GetFileMetadata()->row_groups.size();
 }
 
-void ParquetReader::InitializeScan(ParquetReaderScanState &state, vector<idx_t> groups_to_read) {
+void ParquetReader::InitializeScan(ClientContext &context, ParquetReaderScanState &state,
+                                   vector<idx_t> groups_to_read) {
 	state.current_group = -1;
 	state.finished = false;
 	state.group_offset = 0;
@@ -692,6 +696,10 @@ void ParquetReader::InitializeScan(ParquetReaderScanState &state, vector<idx_t>
 		if (!file_handle->OnDiskFile() && file_handle->CanSeek()) {
 			state.prefetch_mode = true;
 			flags |= FileFlags::FILE_FLAGS_DIRECT_IO;
+			if (file_handle->SupportsPositionalReads()) {
+				// the registered ranges can be read concurrently
+				flags |= FileFlags::FILE_FLAGS_PARALLEL_ACCESS;
+			}
 		} else {
 			state.prefetch_mode = false;
 		}
@@ -699,7 +707,12 @@ void ParquetReader::InitializeScan(ParquetReaderScanState &state, vector<idx_t>
 		state.file_handle = fs.OpenFile(file_handle->path, flags);
 	}
 
-	state.thrift_file_proto = CreateThriftFileProtocol(allocator, *state.file_handle, state.prefetch_mode);
+	shared_ptr<ParquetPrefetchPool> prefetch_pool;
+	if (state.prefetch_mode && state.file_handle->SupportsPositionalReads()) {
+		prefetch_pool = ParquetPrefetchPool::Get(context);
+	}
+	state.thrift_file_proto =
+	    CreateThriftFileProtocol(allocator, *state.file_handle, state.prefetch_mode, std::move(prefetch_pool));
 	state.root_reader = CreateReader();
 	state.define_buf.resize(allocator, STANDARD_VECTOR_SIZE);
 	state.repeat_buf.resize(allocator, STANDARD_VECTOR_SIZE);
@@ -872,6 +885,14 @@ static void ApplyFilter(Vector &v, TableFilter &filter, parquet_filter_t &filter
 		}
 		break;
 	}
+	case TableFilterType::DYNAMIC_FILTER: {
+		auto &dynamic_filter = filter.Cast<DynamicFilter>();
+		auto constant_filter = dynamic_filter.GetFilter();
+		if (constant_filter) {
+			ApplyFilter(v, *constant_filter, filter_mask, count);
+		}
+		break;
+	}
 	case TableFilterType::IS_NOT_NULL:
 		FilterIsNotNull(v, filter_mask, count);
 		break;
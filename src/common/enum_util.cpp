@@ -4168,6 +4168,8 @@ const char* EnumUtil::ToChars<OptimizerType>(OptimizerType value) {
 		return "DUPLICATE_GROUPS";
 	case OptimizerType::REORDER_FILTER:
 		return "REORDER_FILTER";
+	case OptimizerType::EAGER_AGGREGATE:
+		return "EAGER_AGGREGATE";
 	case OptimizerType::EXTENSION:
 		return "EXTENSION";
 	default:
@@ -4231,6 +4233,9 @@ OptimizerType EnumUtil::FromString<OptimizerType>(const char *value) {
 	if (StringUtil::Equals(value, "REORDER_FILTER")) {
 		return OptimizerType::REORDER_FILTER;
 	}
+	if (StringUtil::Equals(value, "EAGER_AGGREGATE")) {
+		return OptimizerType::EAGER_AGGREGATE;
+	}
 	if (StringUtil::Equals(value, "EXTENSION")) {
 		return OptimizerType::EXTENSION;
 	}
@@ -4617,6 +4622,8 @@ const char* EnumUtil::ToChars<PhysicalOperatorType>(PhysicalOperatorType value)
 		return "LIMIT_PERCENT";
 	case PhysicalOperatorType::TOP_N:
 		return "TOP_N";
+	case PhysicalOperatorType::PARTITIONED_TOP_N:
+		return "PARTITIONED_TOP_N";
 	case PhysicalOperatorType::WINDOW:
 		return "WINDOW";
 	case PhysicalOperatorType::UNNEST:
@@ -4627,6 +4634,8 @@ const char* EnumUtil::ToChars<PhysicalOperatorType>(PhysicalOperatorType value)
 		return "HASH_GROUP_BY";
 	case PhysicalOperatorType::PERFECT_HASH_GROUP_BY:
 		return "PERFECT_HASH_GROUP_BY";
+	case PhysicalOperatorType::ORDERED_GROUP_BY:
+		return "ORDERED_GROUP_BY";
 	case PhysicalOperatorType::FILTER:
 		return "FILTER";
 	case PhysicalOperatorType::PROJECTION:
@@ -4782,6 +4791,9 @@ PhysicalOperatorType EnumUtil::FromString<PhysicalOperatorType>(const char *valu
 	if (StringUtil::Equals(value, "TOP_N")) {
 		return PhysicalOperatorType::TOP_N;
 	}
+	if (StringUtil::Equals(value, "PARTITIONED_TOP_N")) {
+		return PhysicalOperatorType::PARTITIONED_TOP_N;
+	}
 	if (StringUtil::Equals(value, "WINDOW")) {
 		return PhysicalOperatorType::WINDOW;
 	}
@@ -4797,6 +4809,9 @@ PhysicalOperatorType EnumUtil::FromString<PhysicalOperatorType>(const char *valu
 	if (StringUtil::Equals(value, "PERFECT_HASH_GROUP_BY")) {
 		return PhysicalOperatorType::PERFECT_HASH_GROUP_BY;
 	}
+	if (StringUtil::Equals(value, "ORDERED_GROUP_BY")) {
+		return PhysicalOperatorType::ORDERED_GROUP_BY;
+	}
 	if (StringUtil::Equals(value, "FILTER")) {
 		return PhysicalOperatorType::FILTER;
 	}
@@ -6545,6 +6560,8 @@ const char* EnumUtil::ToChars<TableFilterType>(TableFilterType value) {
 		return "CONJUNCTION_AND";
 	case TableFilterType::STRUCT_EXTRACT:
 		return "STRUCT_EXTRACT";
+	case TableFilterType::DYNAMIC_FILTER:
+		return "DYNAMIC_FILTER";
 	default:
 		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
 	}
@@ -6570,6 +6587,9 @@ TableFilterType EnumUtil::FromString<TableFilterType>(const char *value) {
 	if (StringUtil::Equals(value, "STRUCT_EXTRACT")) {
 		return TableFilterType::STRUCT_EXTRACT;
 	}
+	if (StringUtil::Equals(value, "DYNAMIC_FILTER")) {
+		return TableFilterType::DYNAMIC_FILTER;
+	}
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
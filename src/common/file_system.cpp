@@ -542,6 +542,10 @@ bool FileSystem::OnDiskFile(FileHandle &handle) {
 }
 // LCOV_EXCL_STOP
 
+bool FileSystem::SupportsPositionalReads(FileHandle &handle) {
+	return false;
+}
+
 FileHandle::FileHandle(FileSystem &file_system, string path_p) : file_system(file_system), path(std::move(path_p)) {
 }
 
@@ -606,6 +610,10 @@ bool FileHandle::OnDiskFile() {
 	return file_system.OnDiskFile(*this);
 }
 
+bool FileHandle::SupportsPositionalReads() {
+	return file_system.SupportsPositionalReads(*this);
+}
+
 idx_t FileHandle::GetFileSize() {
 	return NumericCast<idx_t>(file_system.GetFileSize(*this));
 }
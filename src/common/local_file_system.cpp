@@ -1098,6 +1098,10 @@ bool LocalFileSystem::OnDiskFile(FileHandle &handle) {
 	return true;
 }
 
+bool LocalFileSystem::SupportsPositionalReads(FileHandle &handle) {
+	return true;
+}
+
 void LocalFileSystem::Seek(FileHandle &handle, idx_t location) {
 	if (!CanSeek()) {
 		throw IOException("Cannot seek in files of this type");
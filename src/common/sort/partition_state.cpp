@@ -513,20 +513,22 @@ bool PartitionGlobalMergeState::TryPrepareNextStage() {
 		return true;
 
 	case PartitionSortStage::PREPARE:
-		total_tasks = global_sort->sorted_blocks.size() / 2;
-		if (!total_tasks) {
+		if (global_sort->sorted_blocks.size() < 2) {
 			break;
 		}
+		//	Every merge task claims output partitions of the round until there are none left,
+		//	so all the threads can work on the merge of a single large group
+		total_tasks = num_threads;
 		stage = PartitionSortStage::MERGE;
 		global_sort->InitializeMergeRound();
 		return true;
 
 	case PartitionSortStage::MERGE:
 		global_sort->CompleteMergeRound(true);
-		total_tasks = global_sort->sorted_blocks.size() / 2;
-		if (!total_tasks) {
+		if (global_sort->sorted_blocks.size() < 2) {
 			break;
 		}
+		total_tasks = num_threads;
 		global_sort->InitializeMergeRound();
 		return true;
 
@@ -534,6 +536,8 @@ bool PartitionGlobalMergeState::TryPrepareNextStage() {
 		break;
 	}
 
+	//	No more tasks can be assigned once the group is sorted
+	total_tasks = 0;
 	stage = PartitionSortStage::SORTED;
 
 	return false;
@@ -5,7 +5,107 @@
 
 namespace duckdb {
 
-//! Calls std::sort on strings that are tied by their prefix after the radix sort
+//! A string that is tied with other strings by its prefix, and the row that it belongs to
+struct TiedString {
+	data_ptr_t row_ptr;
+	string_t str;
+};
+
+//! Returns the byte of the string at the given depth, or -1 if the string is shorter than that
+static inline int32_t CharacterAt(const TiedString &str, const idx_t depth) {
+	return depth < str.str.GetSize() ? static_cast<int32_t>(const_data_ptr_cast(str.str.GetData())[depth]) : -1;
+}
+
+//! Compares two strings that are equal in their first 'depth' bytes
+static inline int CompareTiedStrings(const TiedString &l, const TiedString &r, const idx_t depth) {
+	const auto l_size = l.str.GetSize();
+	const auto r_size = r.str.GetSize();
+	const auto comp_res = memcmp(l.str.GetData() + depth, r.str.GetData() + depth, MinValue(l_size, r_size) - depth);
+	if (comp_res != 0) {
+		return comp_res;
+	}
+	return l_size == r_size ? 0 : (l_size < r_size ? -1 : 1);
+}
+
+//! Insertion sort for strings that are equal in their first 'depth' bytes, used when count of values is low
+static void InsertionSortStrings(TiedString *strings, const idx_t count, const idx_t depth) {
+	for (idx_t i = 1; i < count; i++) {
+		const auto str = strings[i];
+		idx_t j = i;
+		while (j > 0 && CompareTiedStrings(strings[j - 1], str, depth) > 0) {
+			strings[j] = strings[j - 1];
+			j--;
+		}
+		strings[j] = str;
+	}
+}
+
+//! Multikey quicksort for strings that are equal in their first 'depth' bytes. Partitions the strings on a single
+//! byte at a time, so the bytes of a common prefix are only looked at once instead of in every comparison
+static void MultikeyQuicksort(TiedString *strings, idx_t count, idx_t depth) {
+	while (count > SortConstants::INSERTION_SORT_THRESHOLD) {
+		// Median of three as the pivot
+		const auto a = CharacterAt(strings[0], depth);
+		const auto b = CharacterAt(strings[count / 2], depth);
+		const auto c = CharacterAt(strings[count - 1], depth);
+		const auto pivot = MaxValue(MinValue(a, b), MinValue(MaxValue(a, b), c));
+		// Three-way partition: [0, lt) is smaller than the pivot, [lt, gt) is equal, and [gt, count) is greater
+		idx_t lt = 0;
+		idx_t gt = count;
+		idx_t i = 0;
+		while (i < gt) {
+			const auto character = CharacterAt(strings[i], depth);
+			if (character < pivot) {
+				std::swap(strings[lt++], strings[i++]);
+			} else if (character > pivot) {
+				std::swap(strings[i], strings[--gt]);
+			} else {
+				i++;
+			}
+		}
+		MultikeyQuicksort(strings, lt, depth);
+		MultikeyQuicksort(strings + gt, count - gt, depth);
+		if (pivot == -1) {
+			// All strings that are equal to the pivot have ended, i.e., they are equal
+			return;
+		}
+		// Continue with the strings that are equal to the pivot on the next byte
+		strings += lt;
+		count = gt - lt;
+		depth++;
+	}
+	InsertionSortStrings(strings, count, depth);
+}
+
+//! Sorts the rows of strings that are tied by their prefix after the radix sort
+static void SortTiedStrings(data_ptr_t entry_ptrs[], const idx_t count, const data_ptr_t blob_ptr,
+                            const idx_t &tie_col_offset, const idx_t &row_width, const SortLayout &sort_layout) {
+	auto string_block = make_unsafe_uniq_array<TiedString>(count);
+	auto strings = string_block.get();
+	for (idx_t i = 0; i < count; i++) {
+		const auto row_idx = Load<uint32_t>(entry_ptrs[i] + sort_layout.comparison_size);
+		strings[i].row_ptr = entry_ptrs[i];
+		strings[i].str = Load<string_t>(blob_ptr + row_idx * row_width + tie_col_offset);
+	}
+	// Skip the prefix that all strings have in common, e.g., the scheme and host of URLs
+	const auto first_data = strings[0].str.GetData();
+	idx_t depth = strings[0].str.GetSize();
+	for (idx_t i = 1; i < count && depth > 0; i++) {
+		const auto data = strings[i].str.GetData();
+		const idx_t max_depth = MinValue<idx_t>(depth, strings[i].str.GetSize());
+		idx_t common = 0;
+		while (common < max_depth && first_data[common] == data[common]) {
+			common++;
+		}
+		depth = common;
+	}
+	MultikeyQuicksort(strings, count, depth);
+	for (idx_t i = 0; i < count; i++) {
+		entry_ptrs[i] = strings[i].row_ptr;
+	}
+}
+
+//! Sorts strings or nested values that are tied by their prefix after the radix sort
 static void SortTiedBlobs(BufferManager &buffer_manager, const data_ptr_t dataptr, const idx_t &start, const idx_t &end,
                           const idx_t &tie_col, bool *ties, const data_ptr_t blob_ptr, const SortLayout &sort_layout) {
 	const auto row_width = sort_layout.blob_layout.GetRowWidth();
@@ -23,20 +123,28 @@ static void SortTiedBlobs(BufferManager &buffer_manager, const data_ptr_t datapt
 		entry_ptrs[i - start] = row_ptr;
 		row_ptr += sort_layout.entry_size;
 	}
-	// Slow pointer-based sorting
 	const int order = sort_layout.order_types[tie_col] == OrderType::DESCENDING ? -1 : 1;
 	const idx_t &col_idx = sort_layout.sorting_to_blob_col.at(tie_col);
 	const auto &tie_col_offset = sort_layout.blob_layout.GetOffsets()[col_idx];
 	auto logical_type = sort_layout.blob_layout.GetTypes()[col_idx];
-	std::sort(entry_ptrs, entry_ptrs + end - start,
-	          [&blob_ptr, &order, &sort_layout, &tie_col_offset, &row_width, &logical_type](const data_ptr_t l,
-	                                                                                        const data_ptr_t r) {
-		          idx_t left_idx = Load<uint32_t>(l + sort_layout.comparison_size);
-		          idx_t right_idx = Load<uint32_t>(r + sort_layout.comparison_size);
-		          data_ptr_t left_ptr = blob_ptr + left_idx * row_width + tie_col_offset;
-		          data_ptr_t right_ptr = blob_ptr + right_idx * row_width + tie_col_offset;
-		          return order * Comparators::CompareVal(left_ptr, right_ptr, logical_type) < 0;
-	          });
+	if (logical_type.InternalType() == PhysicalType::VARCHAR) {
+		// Strings are sorted byte by byte, and reversed if they are sorted in descending order
+		SortTiedStrings(entry_ptrs, end - start, blob_ptr, tie_col_offset, row_width, sort_layout);
+		if (order == -1) {
+			std::reverse(entry_ptrs, entry_ptrs + end - start);
+		}
+	} else {
+		// Slow pointer-based sorting
+		std::sort(entry_ptrs, entry_ptrs + end - start,
+		          [&blob_ptr, &order, &sort_layout, &tie_col_offset, &row_width, &logical_type](const data_ptr_t l,
+		                                                                                        const data_ptr_t r) {
+			          idx_t left_idx = Load<uint32_t>(l + sort_layout.comparison_size);
+			          idx_t right_idx = Load<uint32_t>(r + sort_layout.comparison_size);
+			          data_ptr_t left_ptr = blob_ptr + left_idx * row_width + tie_col_offset;
+			          data_ptr_t right_ptr = blob_ptr + right_idx * row_width + tie_col_offset;
+			          return order * Comparators::CompareVal(left_ptr, right_ptr, logical_type) < 0;
+		          });
+	}
 	// Re-order
 	auto temp_block = buffer_manager.GetBufferAllocator().Allocate((end - start) * sort_layout.entry_size);
 	data_ptr_t temp_ptr = temp_block.get();
@@ -70,13 +70,11 @@ SortLayout::SortLayout(const vector<BoundOrderByNode> &orders)
 			prefix_lengths.back() = GetNestedSortingColSize(col_size, expr.return_type);
 		} else if (physical_type == PhysicalType::VARCHAR) {
 			idx_t size_before = col_size;
-			if (stats.back() && StringStats::HasMaxStringLength(*stats.back())) {
+			if (stats.back() && StringStats::HasMaxStringLength(*stats.back()) &&
+			    StringStats::MaxStringLength(*stats.back()) <= SortConstants::MAX_FULL_STRING_KEY_SIZE) {
+				// The strings are short enough to sort on their full value, so there are no ties to break
 				col_size += StringStats::MaxStringLength(*stats.back());
-				if (col_size > 12) {
-					col_size = 12;
-				} else {
-					constant_size.back() = true;
-				}
+				constant_size.back() = true;
 			} else {
 				col_size = 12;
 			}
@@ -363,7 +361,7 @@ void LocalSortState::ReOrder(GlobalSortState &gstate, bool reorder_heap) {
 GlobalSortState::GlobalSortState(BufferManager &buffer_manager, const vector<BoundOrderByNode> &orders,
                                  RowLayout &payload_layout)
     : buffer_manager(buffer_manager), sort_layout(SortLayout(orders)), payload_layout(payload_layout),
-      block_capacity(0), external(false) {
+      block_capacity(0), external(false), merge_fan_in(0), merge_idx(0), num_merges(0), merge_partition_idx(0) {
 }
 
 void GlobalSortState::AddLocalState(LocalSortState &local_sort_state) {
@@ -434,18 +432,23 @@ void GlobalSortState::InitializeMergeRound() {
 	// If we reverse this list, the blocks that were merged last will be merged first in the next round
 	// These are still in memory, therefore this reduces the amount of read/write to disk!
 	std::reverse(sorted_blocks.begin(), sorted_blocks.end());
-	// Uneven number of blocks - keep one on the side
-	if (sorted_blocks.size() % 2 == 1) {
+	// Merge as many blocks at once as we can, every merge is partitioned so all threads can work on it
+	// During an external sort every block that is merged needs to be pinned, so we merge fewer blocks at once
+	merge_fan_in = external ? SortConstants::EXTERNAL_MERGE_FAN_IN : SortConstants::MERGE_FAN_IN;
+	merge_fan_in = MinValue(merge_fan_in, MaxValue<idx_t>(sorted_blocks.size(), 2));
+	// A single remaining block does not need to be merged - keep it on the side
+	if (sorted_blocks.size() % merge_fan_in == 1) {
 		odd_one_out = std::move(sorted_blocks.back());
 		sorted_blocks.pop_back();
 	}
-	// Init merge path path indices
-	pair_idx = 0;
-	num_pairs = sorted_blocks.size() / 2;
-	l_start = 0;
-	r_start = 0;
+	// Init merge path indices
+	merge_idx = 0;
+	num_merges = (sorted_blocks.size() + merge_fan_in - 1) / merge_fan_in;
+	merge_partition_idx = 0;
+	merge_starts.assign(merge_fan_in, 0);
+	merge_active.assign(num_merges, 0);
 	// Allocate room for merge results
-	for (idx_t p_idx = 0; p_idx < num_pairs; p_idx++) {
+	for (idx_t m_idx = 0; m_idx < num_merges; m_idx++) {
 		sorted_blocks_temp.emplace_back();
 	}
 }
@@ -44,13 +44,6 @@ unique_ptr<SortedData> SortedData::CreateSlice(idx_t start_block_index, idx_t en
 			result->heap_blocks.push_back(heap_blocks[i]->Copy());
 		}
 	}
-	// All of the blocks that come before block with idx = start_block_idx can be reset (other references exist)
-	for (idx_t i = 0; i < start_block_index; i++) {
-		data_blocks[i]->block = nullptr;
-		if (!layout.AllConstant() && state.external) {
-			heap_blocks[i]->block = nullptr;
-		}
-	}
 	// Use start and end entry indices to set the boundaries
 	D_ASSERT(end_entry_index <= result->data_blocks.back()->count);
 	result->data_blocks.back()->count = end_entry_index;
@@ -60,6 +53,15 @@ unique_ptr<SortedData> SortedData::CreateSlice(idx_t start_block_index, idx_t en
 	return result;
 }
 
+void SortedData::ReleaseBlocks(idx_t end_block_index) {
+	for (idx_t i = 0; i < end_block_index; i++) {
+		data_blocks[i]->block = nullptr;
+		if (!layout.AllConstant() && state.external) {
+			heap_blocks[i]->block = nullptr;
+		}
+	}
+}
+
 void SortedData::Unswizzle() {
 	if (layout.AllConstant() || !swizzled) {
 		return;
@@ -167,10 +169,6 @@ unique_ptr<SortedBlock> SortedBlock::CreateSlice(const idx_t start, const idx_t
 	for (idx_t i = start_block_index; i <= end_block_index; i++) {
 		result->radix_sorting_data.push_back(radix_sorting_data[i]->Copy());
 	}
-	// Reset all blocks that come before block with idx = start_block_idx (slice holds new reference)
-	for (idx_t i = 0; i < start_block_index; i++) {
-		radix_sorting_data[i]->block = nullptr;
-	}
 	// Use start and end entry indices to set the boundaries
 	entry_idx = start_entry_index;
 	D_ASSERT(end_entry_index <= result->radix_sorting_data.back()->count);
@@ -184,6 +182,19 @@ unique_ptr<SortedBlock> SortedBlock::CreateSlice(const idx_t start, const idx_t
 	return result;
 }
 
+void SortedBlock::ReleaseBlocks(const idx_t end) {
+	idx_t end_block_index;
+	idx_t end_entry_index;
+	GlobalToLocalIndex(end, end_block_index, end_entry_index);
+	for (idx_t i = 0; i < end_block_index; i++) {
+		radix_sorting_data[i]->block = nullptr;
+	}
+	if (!sort_layout.all_constant) {
+		blob_sorting_data->ReleaseBlocks(end_block_index);
+	}
+	payload_data->ReleaseBlocks(end_block_index);
+}
+
 idx_t SortedBlock::HeapSize() const {
 	idx_t result = 0;
 	if (!sort_layout.all_constant) {
@@ -108,6 +108,126 @@ unique_ptr<HyperLogLog> HyperLogLog::Deserialize(Deserializer &deserializer) {
 	return result;
 }
 
+//===--------------------------------------------------------------------===//
+// Sketches
+//===--------------------------------------------------------------------===//
+// A sketch starts with a version byte and an encoding byte, followed by either
+// (SPARSE) the number of non-zero registers and an (index, value) pair for each of them, or
+// (DENSE) all registers packed as 6-bit values.
+// Whichever encoding is smaller is written.
+static constexpr const uint8_t HLL_SKETCH_VERSION = 1;
+static constexpr const uint8_t HLL_SKETCH_SPARSE = 0;
+static constexpr const uint8_t HLL_SKETCH_DENSE = 1;
+static constexpr const idx_t HLL_SKETCH_HEADER_SIZE = 2;
+static constexpr const idx_t HLL_SKETCH_SPARSE_ENTRY_SIZE = sizeof(uint16_t) + sizeof(uint8_t);
+static constexpr const idx_t HLL_SKETCH_REGISTER_BITS = 6;
+
+static idx_t DenseSketchSize(idx_t register_count) {
+	return HLL_SKETCH_HEADER_SIZE + (register_count * HLL_SKETCH_REGISTER_BITS + 7) / 8;
+}
+
+string HyperLogLog::ToSketch() const {
+	auto register_count = duckdb_hll::get_register_count();
+	auto registers = make_unsafe_uniq_array<uint8_t>(register_count);
+	if (duckdb_hll::hll_get_registers(hll, registers.get()) != HLL_C_OK) {
+		throw InternalException("Could not read HLL registers");
+	}
+	idx_t non_zero = 0;
+	for (idx_t i = 0; i < register_count; i++) {
+		non_zero += registers[i] != 0;
+	}
+
+	string result;
+	auto sparse_size = HLL_SKETCH_HEADER_SIZE + sizeof(uint16_t) + non_zero * HLL_SKETCH_SPARSE_ENTRY_SIZE;
+	if (sparse_size < DenseSketchSize(register_count)) {
+		result.resize(sparse_size);
+		auto ptr = data_ptr_cast(&result[0]);
+		ptr[0] = HLL_SKETCH_VERSION;
+		ptr[1] = HLL_SKETCH_SPARSE;
+		ptr += HLL_SKETCH_HEADER_SIZE;
+		Store<uint16_t>(UnsafeNumericCast<uint16_t>(non_zero), ptr);
+		ptr += sizeof(uint16_t);
+		for (idx_t i = 0; i < register_count; i++) {
+			if (registers[i] == 0) {
+				continue;
+			}
+			Store<uint16_t>(UnsafeNumericCast<uint16_t>(i), ptr);
+			ptr[sizeof(uint16_t)] = registers[i];
+			ptr += HLL_SKETCH_SPARSE_ENTRY_SIZE;
+		}
+	} else {
+		result.resize(DenseSketchSize(register_count), '\0');
+		auto ptr = data_ptr_cast(&result[0]);
+		ptr[0] = HLL_SKETCH_VERSION;
+		ptr[1] = HLL_SKETCH_DENSE;
+		ptr += HLL_SKETCH_HEADER_SIZE;
+		for (idx_t i = 0; i < register_count; i++) {
+			// registers never exceed 6 bits, so they can span at most two bytes
+			auto bit = i * HLL_SKETCH_REGISTER_BITS;
+			auto value = UnsafeNumericCast<uint16_t>(registers[i] << (bit % 8));
+			ptr[bit / 8] |= UnsafeNumericCast<uint8_t>(value & 0xFF);
+			if (value > 0xFF) {
+				ptr[bit / 8 + 1] |= UnsafeNumericCast<uint8_t>(value >> 8);
+			}
+		}
+	}
+	return result;
+}
+
+unique_ptr<HyperLogLog> HyperLogLog::FromSketch(const_data_ptr_t data, idx_t size) {
+	auto register_count = duckdb_hll::get_register_count();
+	if (size < HLL_SKETCH_HEADER_SIZE || data[0] != HLL_SKETCH_VERSION) {
+		throw InvalidInputException("Invalid HyperLogLog sketch: unrecognized header");
+	}
+	auto registers = make_unsafe_uniq_array<uint8_t>(register_count);
+	memset(registers.get(), 0, register_count);
+
+	auto ptr = data + HLL_SKETCH_HEADER_SIZE;
+	switch (data[1]) {
+	case HLL_SKETCH_SPARSE: {
+		if (size < HLL_SKETCH_HEADER_SIZE + sizeof(uint16_t)) {
+			throw InvalidInputException("Invalid HyperLogLog sketch: truncated sparse sketch");
+		}
+		idx_t entry_count = Load<uint16_t>(ptr);
+		ptr += sizeof(uint16_t);
+		if (size != HLL_SKETCH_HEADER_SIZE + sizeof(uint16_t) + entry_count * HLL_SKETCH_SPARSE_ENTRY_SIZE) {
+			throw InvalidInputException("Invalid HyperLogLog sketch: sparse sketch has the wrong size");
+		}
+		for (idx_t i = 0; i < entry_count; i++) {
+			auto index = Load<uint16_t>(ptr);
+			if (index >= register_count) {
+				throw InvalidInputException("Invalid HyperLogLog sketch: register index out of range");
+			}
+			registers[index] = ptr[sizeof(uint16_t)];
+			ptr += HLL_SKETCH_SPARSE_ENTRY_SIZE;
+		}
+		break;
+	}
+	case HLL_SKETCH_DENSE: {
+		if (size != DenseSketchSize(register_count)) {
+			throw InvalidInputException("Invalid HyperLogLog sketch: dense sketch has the wrong size");
+		}
+		for (idx_t i = 0; i < register_count; i++) {
+			auto bit = i * HLL_SKETCH_REGISTER_BITS;
+			uint16_t value = ptr[bit / 8];
+			if (bit / 8 + 1 < size - HLL_SKETCH_HEADER_SIZE) {
+				value |= UnsafeNumericCast<uint16_t>(ptr[bit / 8 + 1] << 8);
+			}
+			registers[i] = UnsafeNumericCast<uint8_t>((value >> (bit % 8)) & ((1 << HLL_SKETCH_REGISTER_BITS) - 1));
+		}
+		break;
+	}
+	default:
+		throw InvalidInputException("Invalid HyperLogLog sketch: unrecognized encoding");
+	}
+
+	auto result = make_uniq<HyperLogLog>();
+	if (duckdb_hll::hll_set_registers(result->hll, registers.get()) != HLL_C_OK) {
+		throw InvalidInputException("Invalid HyperLogLog sketch: register value out of range");
+	}
+	return result;
+}
+
 //===--------------------------------------------------------------------===//
 // Vectorized HLL implementation
 //===--------------------------------------------------------------------===//
@@ -1,5 +1,6 @@
 #include "duckdb/core_functions/aggregate/distributive_functions.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/vector_operations/unary_executor.hpp"
 #include "duckdb/common/types/hash.hpp"
 #include "duckdb/common/types/hyperloglog.hpp"
 #include "duckdb/function/function_set.hpp"
@@ -123,6 +124,55 @@ AggregateFunction GetApproxCountDistinctFunction(const LogicalType &input_type)
 	return fun;
 }
 
+//===--------------------------------------------------------------------===//
+// Sketches
+//===--------------------------------------------------------------------===//
+struct HLLSketchFunction : ApproxCountDistinctFunction {
+	template <class T, class STATE>
+	static void Finalize(STATE &state, T &target, AggregateFinalizeData &finalize_data) {
+		if (!state.log) {
+			finalize_data.ReturnNull();
+			return;
+		}
+		target = StringVector::AddStringOrBlob(finalize_data.result, state.log->ToSketch());
+	}
+};
+
+struct HLLMergeFunction : HLLSketchFunction {
+	template <class INPUT_TYPE, class STATE, class OP>
+	static void Operation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &) {
+		auto log = HyperLogLog::FromSketch(const_data_ptr_cast(input.GetData()), input.GetSize());
+		if (!state.log) {
+			state.log = log.release();
+			return;
+		}
+		auto new_log = state.log->MergePointer(*log);
+		delete state.log;
+		state.log = new_log;
+	}
+
+	template <class INPUT_TYPE, class STATE, class OP>
+	static void ConstantOperation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &unary_input,
+	                              idx_t count) {
+		// merging is idempotent
+		Operation<INPUT_TYPE, STATE, OP>(state, input, unary_input);
+	}
+};
+
+static AggregateFunction GetHLLSketchFunction(const LogicalType &input_type) {
+	auto fun = GetApproxCountDistinctFunction(input_type);
+	fun.return_type = LogicalType::BLOB;
+	fun.finalize = AggregateFunction::StateFinalize<ApproxDistinctCountState, string_t, HLLSketchFunction>;
+	return fun;
+}
+
+static void HLLEstimateFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	UnaryExecutor::Execute<string_t, int64_t>(args.data[0], result, args.size(), [&](string_t sketch) {
+		auto log = HyperLogLog::FromSketch(const_data_ptr_cast(sketch.GetData()), sketch.GetSize());
+		return UnsafeNumericCast<int64_t>(log->Count());
+	});
+}
+
 AggregateFunctionSet ApproxCountDistinctFun::GetFunctions() {
 	AggregateFunctionSet approx_count("approx_count_distinct");
 	approx_count.AddFunction(GetApproxCountDistinctFunction(LogicalType::UTINYINT));
@@ -143,4 +193,21 @@ AggregateFunctionSet ApproxCountDistinctFun::GetFunctions() {
 	return approx_count;
 }
 
+AggregateFunctionSet HllSketchFun::GetFunctions() {
+	AggregateFunctionSet hll_sketch("hll_sketch");
+	for (auto &function : ApproxCountDistinctFun::GetFunctions().functions) {
+		hll_sketch.AddFunction(GetHLLSketchFunction(function.arguments[0]));
+	}
+	return hll_sketch;
+}
+
+AggregateFunction HllMergeFun::GetFunction() {
+	return AggregateFunction::UnaryAggregateDestructor<ApproxDistinctCountState, string_t, string_t, HLLMergeFunction>(
+	    LogicalType::BLOB, LogicalType::BLOB);
+}
+
+ScalarFunction HllEstimateFun::GetFunction() {
+	return ScalarFunction({LogicalType::BLOB}, LogicalType::BIGINT, HLLEstimateFunction);
+}
+
 } // namespace duckdb
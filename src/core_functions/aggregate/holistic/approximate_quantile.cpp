@@ -5,6 +5,7 @@
 #include "duckdb/common/operator/cast_operators.hpp"
 #include "duckdb/common/serializer/serializer.hpp"
 #include "duckdb/common/serializer/deserializer.hpp"
+#include "duckdb/common/vector_operations/binary_executor.hpp"
 
 #include <algorithm>
 #include <cmath>
@@ -325,6 +326,137 @@ AggregateFunction GetApproxQuantileListAggregate(const LogicalType &type) {
 	return fun;
 }
 
+//===--------------------------------------------------------------------===//
+// Sketches
+//===--------------------------------------------------------------------===//
+// A sketch consists of a version byte, the compression of the t-digest and the number of centroids, followed by the
+// (mean, weight) of every centroid in ascending order of their means
+static constexpr const uint8_t TDIGEST_SKETCH_VERSION = 1;
+static constexpr const idx_t TDIGEST_SKETCH_HEADER_SIZE = sizeof(uint8_t) + sizeof(double) + sizeof(uint32_t);
+static constexpr const idx_t TDIGEST_SKETCH_CENTROID_SIZE = 2 * sizeof(double);
+
+static string TDigestToSketch(duckdb_tdigest::TDigest &digest) {
+	digest.compress();
+	auto &centroids = digest.processed();
+
+	string result;
+	result.resize(TDIGEST_SKETCH_HEADER_SIZE + centroids.size() * TDIGEST_SKETCH_CENTROID_SIZE);
+	auto ptr = data_ptr_cast(&result[0]);
+	*ptr = TDIGEST_SKETCH_VERSION;
+	ptr++;
+	Store<double>(digest.compression(), ptr);
+	ptr += sizeof(double);
+	Store<uint32_t>(UnsafeNumericCast<uint32_t>(centroids.size()), ptr);
+	ptr += sizeof(uint32_t);
+	for (auto &centroid : centroids) {
+		Store<double>(centroid.mean(), ptr);
+		Store<double>(centroid.weight(), ptr + sizeof(double));
+		ptr += TDIGEST_SKETCH_CENTROID_SIZE;
+	}
+	return result;
+}
+
+static unique_ptr<duckdb_tdigest::TDigest> TDigestFromSketch(const string_t &sketch) {
+	auto ptr = const_data_ptr_cast(sketch.GetData());
+	auto size = sketch.GetSize();
+	if (size < TDIGEST_SKETCH_HEADER_SIZE || *ptr != TDIGEST_SKETCH_VERSION) {
+		throw InvalidInputException("Invalid t-digest sketch: unrecognized header");
+	}
+	ptr++;
+	auto compression = Load<double>(ptr);
+	ptr += sizeof(double);
+	idx_t centroid_count = Load<uint32_t>(ptr);
+	ptr += sizeof(uint32_t);
+	if (!Value::DoubleIsFinite(compression) || compression <= 0) {
+		throw InvalidInputException("Invalid t-digest sketch: compression out of range");
+	}
+	if (size != TDIGEST_SKETCH_HEADER_SIZE + centroid_count * TDIGEST_SKETCH_CENTROID_SIZE) {
+		throw InvalidInputException("Invalid t-digest sketch: sketch has the wrong size");
+	}
+
+	std::vector<duckdb_tdigest::Centroid> centroids;
+	centroids.reserve(centroid_count);
+	for (idx_t i = 0; i < centroid_count; i++) {
+		auto mean = Load<double>(ptr);
+		auto weight = Load<double>(ptr + sizeof(double));
+		ptr += TDIGEST_SKETCH_CENTROID_SIZE;
+		if (!Value::DoubleIsFinite(mean) || !Value::DoubleIsFinite(weight) || weight <= 0) {
+			throw InvalidInputException("Invalid t-digest sketch: centroid out of range");
+		}
+		if (!centroids.empty() && mean < centroids.back().mean()) {
+			throw InvalidInputException("Invalid t-digest sketch: centroids are not sorted");
+		}
+		centroids.emplace_back(mean, weight);
+	}
+	return make_uniq<duckdb_tdigest::TDigest>(std::move(centroids), std::vector<duckdb_tdigest::Centroid>(),
+	                                          compression, 0, 0);
+}
+
+struct TDigestSketchOperation : public ApproxQuantileOperation {
+	template <class T, class STATE>
+	static void Finalize(STATE &state, T &target, AggregateFinalizeData &finalize_data) {
+		if (state.pos == 0) {
+			finalize_data.ReturnNull();
+			return;
+		}
+		D_ASSERT(state.h);
+		target = StringVector::AddStringOrBlob(finalize_data.result, TDigestToSketch(*state.h));
+	}
+};
+
+struct TDigestMergeOperation : public TDigestSketchOperation {
+	template <class INPUT_TYPE, class STATE, class OP>
+	static void ConstantOperation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &unary_input,
+	                              idx_t count) {
+		for (idx_t i = 0; i < count; i++) {
+			Operation<INPUT_TYPE, STATE, OP>(state, input, unary_input);
+		}
+	}
+
+	template <class INPUT_TYPE, class STATE, class OP>
+	static void Operation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &unary_input) {
+		auto digest = TDigestFromSketch(input);
+		if (digest->processed().empty()) {
+			return;
+		}
+		if (!state.h) {
+			state.h = new duckdb_tdigest::TDigest(100);
+		}
+		state.h->merge(digest.get());
+		state.pos++;
+	}
+};
+
+static void TDigestQuantileFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	BinaryExecutor::ExecuteWithNulls<string_t, double, double>(
+	    args.data[0], args.data[1], result, args.size(),
+	    [&](string_t sketch, double quantile, ValidityMask &mask, idx_t idx) {
+		    if (!(quantile >= 0 && quantile <= 1)) {
+			    throw InvalidInputException("TDIGEST_QUANTILE can only take quantiles in range [0, 1]");
+		    }
+		    auto digest = TDigestFromSketch(sketch);
+		    if (digest->processed().empty()) {
+			    mask.SetInvalid(idx);
+			    return 0.0;
+		    }
+		    return digest->quantile(quantile);
+	    });
+}
+
+AggregateFunction TdigestSketchFun::GetFunction() {
+	return AggregateFunction::UnaryAggregateDestructor<ApproxQuantileState, double, string_t, TDigestSketchOperation>(
+	    LogicalType::DOUBLE, LogicalType::BLOB);
+}
+
+AggregateFunction TdigestMergeFun::GetFunction() {
+	return AggregateFunction::UnaryAggregateDestructor<ApproxQuantileState, string_t, string_t, TDigestMergeOperation>(
+	    LogicalType::BLOB, LogicalType::BLOB);
+}
+
+ScalarFunction TdigestQuantileFun::GetFunction() {
+	return ScalarFunction({LogicalType::BLOB, LogicalType::DOUBLE}, LogicalType::DOUBLE, TDigestQuantileFunction);
+}
+
 AggregateFunctionSet ApproxQuantileFun::GetFunctions() {
 	AggregateFunctionSet approx_quantile;
 	approx_quantile.AddFunction(AggregateFunction({LogicalTypeId::DECIMAL, LogicalType::FLOAT}, LogicalTypeId::DECIMAL,
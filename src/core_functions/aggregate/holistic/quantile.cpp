@@ -568,7 +568,9 @@ struct QuantileSortTree : public MergeSortTree<IDX, IDX> {
 	using BaseTree = MergeSortTree<IDX, IDX>;
 	using Elements = typename BaseTree::Elements;
 
-	explicit QuantileSortTree(Elements &&lowest_level) : BaseTree(std::move(lowest_level)) {
+	//	The tree is only allocated here, it is built lazily by the threads that evaluate the window
+	explicit QuantileSortTree(Elements &&lowest_level) {
+		BaseTree::Allocate(std::move(lowest_level));
 	}
 
 	template <class INPUT_TYPE>
@@ -771,8 +773,10 @@ struct QuantileState {
 	                         const QuantileValue &q) const {
 		D_ASSERT(n > 0);
 		if (qst32) {
+			qst32->Build();
 			return qst32->WindowScalar<INPUT_TYPE, RESULT_TYPE, DISCRETE>(data, frames, n, result, q);
 		} else if (qst64) {
+			qst64->Build();
 			return qst64->WindowScalar<INPUT_TYPE, RESULT_TYPE, DISCRETE>(data, frames, n, result, q);
 		} else if (s) {
 			// Find the position(s) needed
@@ -189,6 +189,9 @@ static const StaticFunctionDefinition internal_functions[] = {
 	DUCKDB_SCALAR_FUNCTION(HashFun),
 	DUCKDB_SCALAR_FUNCTION_SET(HexFun),
 	DUCKDB_AGGREGATE_FUNCTION_SET(HistogramFun),
+	DUCKDB_SCALAR_FUNCTION(HllEstimateFun),
+	DUCKDB_AGGREGATE_FUNCTION(HllMergeFun),
+	DUCKDB_AGGREGATE_FUNCTION_SET(HllSketchFun),
 	DUCKDB_SCALAR_FUNCTION_SET(HoursFun),
 	DUCKDB_SCALAR_FUNCTION(InSearchPathFun),
 	DUCKDB_SCALAR_FUNCTION(InstrFun),
@@ -340,6 +343,9 @@ static const StaticFunctionDefinition internal_functions[] = {
 	DUCKDB_AGGREGATE_FUNCTION_SET(SumNoOverflowFun),
 	DUCKDB_AGGREGATE_FUNCTION_ALIAS(SumkahanFun),
 	DUCKDB_SCALAR_FUNCTION(TanFun),
+	DUCKDB_AGGREGATE_FUNCTION(TdigestMergeFun),
+	DUCKDB_SCALAR_FUNCTION(TdigestQuantileFun),
+	DUCKDB_AGGREGATE_FUNCTION(TdigestSketchFun),
 	DUCKDB_SCALAR_FUNCTION_SET(TimeBucketFun),
 	DUCKDB_SCALAR_FUNCTION_SET(TimezoneFun),
 	DUCKDB_SCALAR_FUNCTION_SET(TimezoneHourFun),
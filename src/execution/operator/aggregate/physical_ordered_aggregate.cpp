@@ -0,0 +1,828 @@
+#include "duckdb/execution/operator/aggregate/physical_ordered_aggregate.hpp"
+
+#include "duckdb/common/row_operations/row_operations.hpp"
+#include "duckdb/common/sort/sort.hpp"
+#include "duckdb/common/sort/sorted_block.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
+#include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/storage/arena_allocator.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+
+namespace duckdb {
+
+PhysicalOrderedAggregate::PhysicalOrderedAggregate(ClientContext &context, vector<LogicalType> types_p,
+                                                   vector<unique_ptr<Expression>> aggregates_p,
+                                                   vector<unique_ptr<Expression>> groups_p, bool input_ordered,
+                                                   idx_t estimated_cardinality)
+    : PhysicalOperator(PhysicalOperatorType::ORDERED_GROUP_BY, std::move(types_p), estimated_cardinality),
+      groups(std::move(groups_p)), input_ordered(input_ordered), aggregates(std::move(aggregates_p)) {
+	for (auto &expr : groups) {
+		group_types.push_back(expr->return_type);
+	}
+
+	vector<BoundAggregateExpression *> bindings;
+	vector<LogicalType> payload_types_filters;
+	for (auto &expr : aggregates) {
+		D_ASSERT(expr->expression_class == ExpressionClass::BOUND_AGGREGATE);
+		D_ASSERT(expr->IsAggregate());
+		auto &aggr = expr->Cast<BoundAggregateExpression>();
+		bindings.push_back(&aggr);
+
+		D_ASSERT(!aggr.IsDistinct());
+		D_ASSERT(aggr.function.combine);
+		for (auto &child : aggr.children) {
+			payload_types.push_back(child->return_type);
+		}
+		if (aggr.filter) {
+			payload_types_filters.push_back(aggr.filter->return_type);
+		}
+	}
+	for (const auto &pay_filters : payload_types_filters) {
+		payload_types.push_back(pay_filters);
+	}
+	aggregate_objects = AggregateObject::CreateAggregateObjects(bindings);
+	layout.Initialize(aggregate_objects);
+
+	// filter_indexes must be pre-built, not lazily instantiated in parallel...
+	idx_t aggregate_input_idx = 0;
+	for (auto &aggregate : aggregates) {
+		auto &aggr = aggregate->Cast<BoundAggregateExpression>();
+		aggregate_input_idx += aggr.children.size();
+	}
+	for (auto &aggregate : aggregates) {
+		auto &aggr = aggregate->Cast<BoundAggregateExpression>();
+		if (aggr.filter) {
+			auto &bound_ref_expr = aggr.filter->Cast<BoundReferenceExpression>();
+			auto it = filter_indexes.find(aggr.filter.get());
+			if (it == filter_indexes.end()) {
+				filter_indexes[aggr.filter.get()] = bound_ref_expr.index;
+				bound_ref_expr.index = aggregate_input_idx++;
+			} else {
+				++aggregate_input_idx;
+			}
+		}
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Runs
+//===--------------------------------------------------------------------===//
+//! Compares every row of "groups" with the row before it, which is stored at the same position in "previous". The
+//! rows before "start" are not compared, and always start a new run. Writes the rows that start a new run to
+//! "new_runs" (in ascending order), and sets "sorted" to false if any row is smaller than the row before it.
+static idx_t FindNewRuns(DataChunk &groups, DataChunk &previous, idx_t start, SelectionVector &new_runs,
+                         bool &sorted) {
+	const auto count = groups.size();
+	bool is_new_run[STANDARD_VECTOR_SIZE];
+	for (idx_t i = 0; i < count; i++) {
+		is_new_run[i] = i < start;
+	}
+
+	// the rows that are equal to the row before them in all of the columns that were compared so far
+	SelectionVector remaining(STANDARD_VECTOR_SIZE);
+	idx_t remaining_count = 0;
+	for (idx_t i = start; i < count; i++) {
+		remaining.set_index(remaining_count++, i);
+	}
+	SelectionVector greater(STANDARD_VECTOR_SIZE);
+	SelectionVector equal(STANDARD_VECTOR_SIZE);
+	SelectionVector not_equal(STANDARD_VECTOR_SIZE);
+	for (idx_t col_idx = 0; col_idx < groups.ColumnCount() && remaining_count > 0; col_idx++) {
+		// the comparisons read their input densely and only use the selection to map the results back: slice the
+		// columns to the remaining rows first
+		Vector current_col(groups.data[col_idx], remaining, remaining_count);
+		Vector previous_col(previous.data[col_idx], remaining, remaining_count);
+		auto greater_count = VectorOperations::DistinctGreaterThan(current_col, previous_col, &remaining,
+		                                                           remaining_count, &greater, nullptr);
+		auto equal_count = VectorOperations::NotDistinctFrom(current_col, previous_col, &remaining, remaining_count,
+		                                                     &equal, &not_equal);
+		if (greater_count + equal_count < remaining_count) {
+			sorted = false;
+		}
+		for (idx_t i = 0; i < remaining_count - equal_count; i++) {
+			is_new_run[not_equal.get_index(i)] = true;
+		}
+		// only the rows that are equal so far are compared on the next column
+		for (idx_t i = 0; i < equal_count; i++) {
+			remaining.set_index(i, equal.get_index(i));
+		}
+		remaining_count = equal_count;
+	}
+
+	idx_t new_run_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		if (is_new_run[i]) {
+			new_runs.set_index(new_run_count++, i);
+		}
+	}
+	return new_run_count;
+}
+
+//! The runs of a single batch of the input. Consecutive rows with equal groups form a run, and share a single
+//! aggregate state. If the input is known to be ordered on all groups, a run can only continue in the batches before
+//! and after it if it is the first or the last run of the batch: all other runs are finalized as soon as they end.
+class OrderedAggregateRuns {
+public:
+	OrderedAggregateRuns(ClientContext &context, const PhysicalOrderedAggregate &op, idx_t batch_index)
+	    : batch_index(batch_index), layout(op.layout.Copy()), groups(context, op.group_types),
+	      allocator(Allocator::Get(context)), sorted(true) {
+		first_group.Initialize(Allocator::Get(context), op.group_types);
+		last_group.Initialize(Allocator::Get(context), op.group_types);
+		if (op.input_ordered) {
+			finalized = make_uniq<ColumnDataCollection>(context, op.types);
+		}
+	}
+	~OrderedAggregateRuns() {
+		DestroyStates();
+	}
+
+	void DestroyStates() {
+		bool has_destructor = false;
+		for (auto &aggr : layout.GetAggregates()) {
+			if (aggr.function.destructor) {
+				has_destructor = true;
+			}
+		}
+		if (!has_destructor) {
+			states.clear();
+			return;
+		}
+		Vector addresses(LogicalType::POINTER);
+		auto address_data = FlatVector::GetData<data_ptr_t>(addresses);
+		RowOperationsState row_state(allocator);
+		idx_t count = 0;
+		for (auto state : states) {
+			address_data[count++] = state;
+			if (count == STANDARD_VECTOR_SIZE) {
+				RowOperations::DestroyStates(row_state, layout, addresses, count);
+				count = 0;
+			}
+		}
+		RowOperations::DestroyStates(row_state, layout, addresses, count);
+		states.clear();
+	}
+
+	//! Stores the groups of the runs that were kept, once all input of the batch has been aggregated
+	void FinishBatch() {
+		if (!finalized) {
+			return;
+		}
+		D_ASSERT(groups.Count() == 0 && !states.empty());
+		if (states.size() > 1) {
+			groups.Append(first_group);
+		}
+		groups.Append(last_group);
+	}
+
+public:
+	//! The batch index of the input
+	idx_t batch_index;
+	//! The layout of the aggregate states
+	TupleDataLayout layout;
+	//! The groups of the runs
+	ColumnDataCollection groups;
+	//! The aggregate states of the runs, in the same order as the groups
+	vector<data_ptr_t> states;
+	//! The allocator for the aggregate states
+	ArenaAllocator allocator;
+	//! Whether or not every run is greater than the run before it
+	bool sorted;
+	//! The groups of the first and of the last run
+	DataChunk first_group;
+	DataChunk last_group;
+	//! The aggregated runs that have been finalized already (if the input is ordered on all groups)
+	unique_ptr<ColumnDataCollection> finalized;
+};
+
+//! Merges a stream of runs in which all runs with equal groups are adjacent, and finalizes the aggregates
+class OrderedAggregateMerger {
+public:
+	OrderedAggregateMerger(ClientContext &context, const PhysicalOrderedAggregate &op, TupleDataLayout &layout,
+	                       ArenaAllocator &allocator, ColumnDataCollection &result)
+	    : group_count(op.group_types.size()), layout(layout), row_state(allocator), result(result),
+	      new_runs(STANDARD_VECTOR_SIZE), sources(LogicalType::POINTER), targets(LogicalType::POINTER),
+	      addresses(LogicalType::POINTER), has_pending(false), pending_state(nullptr) {
+		previous.Initialize(Allocator::Get(context), op.group_types);
+		pending_group.Initialize(Allocator::Get(context), op.group_types);
+		output.Initialize(Allocator::Get(context), op.types);
+	}
+
+	void Merge(DataChunk &groups, const data_ptr_t states[]) {
+		const auto count = groups.size();
+		if (count == 0) {
+			return;
+		}
+		// compare every row with the row before it
+		previous.Reset();
+		for (idx_t col_idx = 0; col_idx < group_count; col_idx++) {
+			if (has_pending) {
+				VectorOperations::Copy(pending_group.data[col_idx], previous.data[col_idx], 1, 0, 0);
+			}
+			VectorOperations::Copy(groups.data[col_idx], previous.data[col_idx], count - 1, 0, 1);
+		}
+		previous.SetCardinality(count);
+		bool sorted = true;
+		auto new_run_count = FindNewRuns(groups, previous, has_pending ? 0 : 1, new_runs, sorted);
+
+		// combine the states of the runs that continue a group into the state of the first run of the group
+		auto source_data = FlatVector::GetData<data_ptr_t>(sources);
+		auto target_data = FlatVector::GetData<data_ptr_t>(targets);
+		data_ptr_t current = pending_state;
+		idx_t combine_count = 0;
+		idx_t run_idx = 0;
+		for (idx_t i = 0; i < count; i++) {
+			if (run_idx < new_run_count && new_runs.get_index(run_idx) == i) {
+				current = states[i];
+				run_idx++;
+				continue;
+			}
+			source_data[combine_count] = states[i];
+			target_data[combine_count] = current;
+			combine_count++;
+		}
+		RowOperations::CombineStates(row_state, layout, sources, targets, combine_count);
+
+		if (new_run_count == 0) {
+			// the pending group continues
+			return;
+		}
+		// a new group starts: the pending group is complete
+		if (has_pending) {
+			output.Reset();
+			for (idx_t col_idx = 0; col_idx < group_count; col_idx++) {
+				output.data[col_idx].Reference(pending_group.data[col_idx]);
+			}
+			output.SetCardinality(1);
+			FlatVector::GetData<data_ptr_t>(addresses)[0] = pending_state;
+			Finalize();
+		}
+		// all groups that start in this chunk are complete, except for the last one
+		output.Reset();
+		output.Slice(groups, new_runs, new_run_count - 1);
+		auto address_data = FlatVector::GetData<data_ptr_t>(addresses);
+		for (idx_t i = 0; i + 1 < new_run_count; i++) {
+			address_data[i] = states[new_runs.get_index(i)];
+		}
+		Finalize();
+
+		// the last group becomes the pending group
+		auto last_run = new_runs.get_index(new_run_count - 1);
+		pending_group.Reset();
+		for (idx_t col_idx = 0; col_idx < group_count; col_idx++) {
+			VectorOperations::Copy(groups.data[col_idx], pending_group.data[col_idx], last_run + 1, last_run, 0);
+		}
+		pending_group.SetCardinality(1);
+		pending_state = states[last_run];
+		has_pending = true;
+	}
+
+	void Finish() {
+		if (!has_pending) {
+			return;
+		}
+		output.Reset();
+		for (idx_t col_idx = 0; col_idx < group_count; col_idx++) {
+			output.data[col_idx].Reference(pending_group.data[col_idx]);
+		}
+		output.SetCardinality(1);
+		FlatVector::GetData<data_ptr_t>(addresses)[0] = pending_state;
+		Finalize();
+		has_pending = false;
+	}
+
+private:
+	void Finalize() {
+		if (output.size() == 0) {
+			return;
+		}
+		RowOperations::FinalizeStates(row_state, layout, addresses, output, group_count);
+		result.Append(output);
+	}
+
+private:
+	idx_t group_count;
+	TupleDataLayout &layout;
+	RowOperationsState row_state;
+	ColumnDataCollection &result;
+
+	DataChunk previous;
+	SelectionVector new_runs;
+	Vector sources;
+	Vector targets;
+	Vector addresses;
+	DataChunk output;
+
+	//! The last group seen so far, which might continue in the next chunk
+	bool has_pending;
+	DataChunk pending_group;
+	data_ptr_t pending_state;
+};
+
+//===--------------------------------------------------------------------===//
+// Sink
+//===--------------------------------------------------------------------===//
+class OrderedAggregateGlobalSinkState : public GlobalSinkState {
+public:
+	OrderedAggregateGlobalSinkState(ClientContext &context, const PhysicalOrderedAggregate &op)
+	    : layout(op.layout.Copy()), allocator(Allocator::Get(context)),
+	      result(make_uniq<ColumnDataCollection>(context, op.types)) {
+	}
+	~OrderedAggregateGlobalSinkState() override {
+		// the states of a batch can reference memory of other batches after they have been combined
+		// destroy all of them before any of the allocators is released
+		for (auto &runs : batches) {
+			runs->DestroyStates();
+		}
+	}
+
+	void AddRuns(unique_ptr<OrderedAggregateRuns> runs) {
+		if (!runs) {
+			return;
+		}
+		runs->FinishBatch();
+		lock_guard<mutex> guard(lock);
+		if (runs->finalized) {
+			result->Combine(*runs->finalized);
+			runs->finalized.reset();
+		}
+		batches.push_back(std::move(runs));
+	}
+
+	//! The lock for adding batches
+	mutex lock;
+	//! The layout of the aggregate states
+	TupleDataLayout layout;
+	//! The allocator used while merging the batches
+	ArenaAllocator allocator;
+	//! The runs of every batch
+	vector<unique_ptr<OrderedAggregateRuns>> batches;
+	//! The aggregated result
+	unique_ptr<ColumnDataCollection> result;
+};
+
+class OrderedAggregateLocalSinkState : public LocalSinkState {
+public:
+	OrderedAggregateLocalSinkState(ExecutionContext &context, const PhysicalOrderedAggregate &op)
+	    : layout(op.layout.Copy()), new_runs(STANDARD_VECTOR_SIZE), addresses(LogicalType::POINTER),
+	      new_run_addresses(LogicalType::POINTER), finished_addresses(LogicalType::POINTER),
+	      sources(LogicalType::POINTER), targets(LogicalType::POINTER) {
+		group_chunk.InitializeEmpty(op.group_types);
+		if (!op.payload_types.empty()) {
+			aggregate_input_chunk.InitializeEmpty(op.payload_types);
+		}
+		new_groups.InitializeEmpty(op.group_types);
+		previous_groups.Initialize(Allocator::Get(context.client), op.group_types);
+		filter_set.Initialize(context.client, op.aggregate_objects, op.payload_types);
+		if (op.input_ordered) {
+			auto run_states_size = MaxValue<idx_t>(STANDARD_VECTOR_SIZE * layout.GetRowWidth(), 1);
+			run_states = make_unsafe_uniq_array<data_t>(run_states_size);
+			finished.Initialize(Allocator::Get(context.client), op.types);
+		}
+	}
+
+	//! The layout of the aggregate states
+	TupleDataLayout layout;
+	//! The runs of the batch that is currently being aggregated
+	unique_ptr<OrderedAggregateRuns> runs;
+
+	DataChunk group_chunk;
+	DataChunk aggregate_input_chunk;
+	//! The groups of the row before every row of the chunk
+	DataChunk previous_groups;
+	//! The groups of the rows that start a new run
+	DataChunk new_groups;
+	SelectionVector new_runs;
+	//! The state of every row of the chunk
+	Vector addresses;
+	//! The states of the new runs
+	Vector new_run_addresses;
+	AggregateFilterDataSet filter_set;
+
+	//! The temporary states of the new runs of a chunk (if the input is ordered on all groups)
+	unsafe_unique_array<data_t> run_states;
+	//! The runs that ended in the chunk, and their states
+	DataChunk finished;
+	Vector finished_addresses;
+	//! The temporary states of the runs that are kept, and the states they are moved into
+	Vector sources;
+	Vector targets;
+};
+
+static void UpdateRunStates(OrderedAggregateLocalSinkState &lstate, OrderedAggregateRuns &runs, idx_t count) {
+	idx_t payload_idx = 0;
+	auto &aggregates = lstate.layout.GetAggregates();
+	RowOperationsState row_state(runs.allocator);
+	for (idx_t aggr_idx = 0; aggr_idx < aggregates.size(); aggr_idx++) {
+		auto &aggregate = aggregates[aggr_idx];
+		auto input_count = (idx_t)aggregate.child_count;
+		if (aggregate.filter) {
+			RowOperations::UpdateFilteredStates(row_state, lstate.filter_set.GetFilterData(aggr_idx), aggregate,
+			                                    lstate.addresses, lstate.aggregate_input_chunk, payload_idx);
+		} else {
+			RowOperations::UpdateStates(row_state, aggregate, lstate.addresses, lstate.aggregate_input_chunk,
+			                            payload_idx, count);
+		}
+		// move to the next aggregate
+		payload_idx += input_count;
+		VectorOperations::AddInPlace(lstate.addresses, UnsafeNumericCast<int64_t>(aggregate.payload_size), count);
+	}
+}
+
+static void StoreLastGroup(OrderedAggregateLocalSinkState &lstate, OrderedAggregateRuns &runs, idx_t count) {
+	runs.last_group.Reset();
+	for (idx_t col_idx = 0; col_idx < lstate.group_chunk.ColumnCount(); col_idx++) {
+		VectorOperations::Copy(lstate.group_chunk.data[col_idx], runs.last_group.data[col_idx], count, count - 1, 0);
+	}
+	runs.last_group.SetCardinality(1);
+}
+
+//! Aggregates a chunk of input that is ordered on all groups. The runs of the batch that have ended are finalized
+//! right away, only the states of the first run (which can continue the batch before it) and of the last run (which
+//! can continue in the next chunk, or in the batch after it) are kept.
+static void SinkOrderedRuns(OrderedAggregateLocalSinkState &lstate, OrderedAggregateRuns &runs, idx_t new_run_count) {
+	const auto count = lstate.group_chunk.size();
+	const auto group_count = lstate.group_chunk.ColumnCount();
+	const auto row_width = lstate.layout.GetRowWidth();
+	const bool has_last_run = !runs.states.empty();
+
+	// the new runs are aggregated into temporary states, the rows that continue the last run into its state
+	auto new_run_data = FlatVector::GetData<data_ptr_t>(lstate.new_run_addresses);
+	auto address_data = FlatVector::GetData<data_ptr_t>(lstate.addresses);
+	data_ptr_t current = has_last_run ? runs.states.back() : nullptr;
+	idx_t run_idx = 0;
+	for (idx_t i = 0; i < count; i++) {
+		if (run_idx < new_run_count && lstate.new_runs.get_index(run_idx) == i) {
+			current = lstate.run_states.get() + run_idx * row_width;
+			new_run_data[run_idx] = current;
+			run_idx++;
+		}
+		address_data[i] = current;
+	}
+	RowOperations::InitializeStates(lstate.layout, lstate.new_run_addresses, *FlatVector::IncrementalSelectionVector(),
+	                                new_run_count);
+	UpdateRunStates(lstate, runs, count);
+	if (new_run_count == 0) {
+		// the last run continues
+		return;
+	}
+
+	RowOperationsState row_state(runs.allocator);
+	auto &finished = lstate.finished;
+	auto finished_data = FlatVector::GetData<data_ptr_t>(lstate.finished_addresses);
+	auto source_data = FlatVector::GetData<data_ptr_t>(lstate.sources);
+	auto target_data = FlatVector::GetData<data_ptr_t>(lstate.targets);
+	finished.Reset();
+	idx_t finished_count = 0;
+	idx_t kept_count = 0;
+
+	// the last run of the previous chunk has ended: finalize it, unless it is the first run of the batch
+	bool reuse_last_state = false;
+	if (has_last_run && runs.states.size() > 1) {
+		for (idx_t col_idx = 0; col_idx < group_count; col_idx++) {
+			VectorOperations::Copy(runs.last_group.data[col_idx], finished.data[col_idx], 1, 0, 0);
+		}
+		finished_data[finished_count++] = runs.states.back();
+		reuse_last_state = true;
+	}
+	// the runs that start in this chunk have ended, except for the last one
+	idx_t first_finished_run = 0;
+	if (!has_last_run && new_run_count > 1) {
+		// the first run of the batch has ended: keep its state
+		runs.states.push_back(runs.allocator.AllocateAligned(row_width));
+		source_data[kept_count] = new_run_data[0];
+		target_data[kept_count] = runs.states.back();
+		kept_count++;
+		first_finished_run = 1;
+	}
+	for (idx_t col_idx = 0; col_idx < group_count; col_idx++) {
+		VectorOperations::Copy(lstate.group_chunk.data[col_idx], finished.data[col_idx], lstate.new_runs,
+		                       new_run_count - 1, first_finished_run, finished_count);
+	}
+	for (idx_t i = first_finished_run; i + 1 < new_run_count; i++) {
+		finished_data[finished_count++] = new_run_data[i];
+	}
+	finished.SetCardinality(finished_count);
+	if (finished_count > 0) {
+		RowOperations::FinalizeStates(row_state, lstate.layout, lstate.finished_addresses, finished, group_count);
+		runs.finalized->Append(finished);
+	}
+
+	// the last run that starts in this chunk becomes the last run of the batch
+	if (reuse_last_state) {
+		FlatVector::GetData<data_ptr_t>(lstate.finished_addresses)[0] = runs.states.back();
+		RowOperations::DestroyStates(row_state, lstate.layout, lstate.finished_addresses, 1);
+	} else {
+		runs.states.push_back(runs.allocator.AllocateAligned(row_width));
+	}
+	source_data[kept_count] = new_run_data[new_run_count - 1];
+	target_data[kept_count] = runs.states.back();
+	kept_count++;
+	RowOperations::InitializeStates(lstate.layout, lstate.targets, *FlatVector::IncrementalSelectionVector(),
+	                                kept_count);
+	RowOperations::CombineStates(row_state, lstate.layout, lstate.sources, lstate.targets, kept_count);
+	RowOperations::DestroyStates(row_state, lstate.layout, lstate.new_run_addresses, new_run_count);
+	StoreLastGroup(lstate, runs, count);
+}
+
+unique_ptr<GlobalSinkState> PhysicalOrderedAggregate::GetGlobalSinkState(ClientContext &context) const {
+	return make_uniq<OrderedAggregateGlobalSinkState>(context, *this);
+}
+
+unique_ptr<LocalSinkState> PhysicalOrderedAggregate::GetLocalSinkState(ExecutionContext &context) const {
+	return make_uniq<OrderedAggregateLocalSinkState>(context, *this);
+}
+
+SinkResultType PhysicalOrderedAggregate::Sink(ExecutionContext &context, DataChunk &chunk,
+                                              OperatorSinkInput &input) const {
+	auto &lstate = input.local_state.Cast<OrderedAggregateLocalSinkState>();
+	DataChunk &group_chunk = lstate.group_chunk;
+	DataChunk &aggregate_input_chunk = lstate.aggregate_input_chunk;
+
+	for (idx_t group_idx = 0; group_idx < groups.size(); group_idx++) {
+		auto &group = groups[group_idx];
+		D_ASSERT(group->type == ExpressionType::BOUND_REF);
+		auto &bound_ref_expr = group->Cast<BoundReferenceExpression>();
+		group_chunk.data[group_idx].Reference(chunk.data[bound_ref_expr.index]);
+	}
+	idx_t aggregate_input_idx = 0;
+	for (auto &aggregate : aggregates) {
+		auto &aggr = aggregate->Cast<BoundAggregateExpression>();
+		for (auto &child_expr : aggr.children) {
+			D_ASSERT(child_expr->type == ExpressionType::BOUND_REF);
+			auto &bound_ref_expr = child_expr->Cast<BoundReferenceExpression>();
+			aggregate_input_chunk.data[aggregate_input_idx++].Reference(chunk.data[bound_ref_expr.index]);
+		}
+	}
+	for (auto &aggregate : aggregates) {
+		auto &aggr = aggregate->Cast<BoundAggregateExpression>();
+		if (aggr.filter) {
+			auto it = filter_indexes.find(aggr.filter.get());
+			D_ASSERT(it != filter_indexes.end());
+			aggregate_input_chunk.data[aggregate_input_idx++].Reference(chunk.data[it->second]);
+		}
+	}
+	const auto count = chunk.size();
+	group_chunk.SetCardinality(count);
+	aggregate_input_chunk.SetCardinality(count);
+	if (count == 0) {
+		return SinkResultType::NEED_MORE_INPUT;
+	}
+
+	if (!lstate.runs) {
+		lstate.runs =
+		    make_uniq<OrderedAggregateRuns>(context.client, *this, lstate.partition_info.batch_index.GetIndex());
+	}
+	auto &runs = *lstate.runs;
+
+	// compare every row with the row before it to find the rows that start a new run
+	// the first row is compared with the last row of the previous chunk of this batch
+	auto &previous = lstate.previous_groups;
+	previous.Reset();
+	idx_t start = runs.states.empty() ? 1 : 0;
+	for (idx_t col_idx = 0; col_idx < group_chunk.ColumnCount(); col_idx++) {
+		if (!runs.states.empty()) {
+			VectorOperations::Copy(runs.last_group.data[col_idx], previous.data[col_idx], 1, 0, 0);
+		}
+		VectorOperations::Copy(group_chunk.data[col_idx], previous.data[col_idx], count - 1, 0, 1);
+	}
+	previous.SetCardinality(count);
+	auto new_run_count = FindNewRuns(group_chunk, previous, start, lstate.new_runs, runs.sorted);
+	if (runs.states.empty()) {
+		for (idx_t col_idx = 0; col_idx < group_chunk.ColumnCount(); col_idx++) {
+			VectorOperations::Copy(group_chunk.data[col_idx], runs.first_group.data[col_idx], 1, 0, 0);
+		}
+		runs.first_group.SetCardinality(1);
+	}
+	if (input_ordered) {
+		SinkOrderedRuns(lstate, runs, new_run_count);
+		return SinkResultType::NEED_MORE_INPUT;
+	}
+
+	// allocate the aggregate states of the new runs, and point every row to the state of its run
+	const auto row_width = layout.GetRowWidth();
+	auto state_data = new_run_count > 0 ? runs.allocator.AllocateAligned(new_run_count * row_width) : nullptr;
+	auto new_run_data = FlatVector::GetData<data_ptr_t>(lstate.new_run_addresses);
+	auto address_data = FlatVector::GetData<data_ptr_t>(lstate.addresses);
+	data_ptr_t current = runs.states.empty() ? nullptr : runs.states.back();
+	idx_t run_idx = 0;
+	for (idx_t i = 0; i < count; i++) {
+		if (run_idx < new_run_count && lstate.new_runs.get_index(run_idx) == i) {
+			current = state_data + run_idx * row_width;
+			new_run_data[run_idx] = current;
+			runs.states.push_back(current);
+			run_idx++;
+		}
+		address_data[i] = current;
+	}
+	RowOperations::InitializeStates(lstate.layout, lstate.new_run_addresses, *FlatVector::IncrementalSelectionVector(),
+	                                new_run_count);
+
+	// store the groups of the new runs
+	if (new_run_count > 0) {
+		lstate.new_groups.Slice(group_chunk, lstate.new_runs, new_run_count);
+		runs.groups.Append(lstate.new_groups);
+	}
+	StoreLastGroup(lstate, runs, count);
+
+	// update the aggregate states
+	UpdateRunStates(lstate, runs, count);
+	return SinkResultType::NEED_MORE_INPUT;
+}
+
+SinkNextBatchType PhysicalOrderedAggregate::NextBatch(ExecutionContext &context,
+                                                      OperatorSinkNextBatchInput &input) const {
+	auto &gstate = input.global_state.Cast<OrderedAggregateGlobalSinkState>();
+	auto &lstate = input.local_state.Cast<OrderedAggregateLocalSinkState>();
+	// the runs of a batch are only merged with the runs of the other batches in the finalize
+	gstate.AddRuns(std::move(lstate.runs));
+	return SinkNextBatchType::READY;
+}
+
+//===--------------------------------------------------------------------===//
+// Combine
+//===--------------------------------------------------------------------===//
+SinkCombineResultType PhysicalOrderedAggregate::Combine(ExecutionContext &context,
+                                                        OperatorSinkCombineInput &input) const {
+	auto &gstate = input.global_state.Cast<OrderedAggregateGlobalSinkState>();
+	auto &lstate = input.local_state.Cast<OrderedAggregateLocalSinkState>();
+	gstate.AddRuns(std::move(lstate.runs));
+	return SinkCombineResultType::FINISHED;
+}
+
+//===--------------------------------------------------------------------===//
+// Finalize
+//===--------------------------------------------------------------------===//
+static void MergeSortedRuns(ClientContext &context, const PhysicalOrderedAggregate &op,
+                            OrderedAggregateGlobalSinkState &gstate, OrderedAggregateMerger &merger) {
+	// the runs of all batches together are ordered: merge them in batch order
+	for (auto &runs : gstate.batches) {
+		ColumnDataScanState scan_state;
+		runs->groups.InitializeScan(scan_state);
+		DataChunk groups;
+		runs->groups.InitializeScanChunk(groups);
+		idx_t offset = 0;
+		while (runs->groups.Scan(scan_state, groups)) {
+			merger.Merge(groups, runs->states.data() + offset);
+			offset += groups.size();
+		}
+	}
+}
+
+static void MergeUnsortedRuns(ClientContext &context, const PhysicalOrderedAggregate &op,
+                              OrderedAggregateGlobalSinkState &gstate, OrderedAggregateMerger &merger) {
+	// the input was not ordered: sort the runs on their groups so that all runs of a group are adjacent
+	vector<BoundOrderByNode> orders;
+	for (idx_t group_idx = 0; group_idx < op.group_types.size(); group_idx++) {
+		orders.emplace_back(OrderType::ASCENDING, OrderByNullType::NULLS_LAST,
+		                    make_uniq<BoundReferenceExpression>(op.group_types[group_idx], group_idx));
+	}
+	// the payload consists of the groups and a pointer to the aggregate state of the run
+	auto payload_types = op.group_types;
+	payload_types.push_back(LogicalType::UBIGINT);
+	RowLayout payload_layout;
+	payload_layout.Initialize(payload_types);
+
+	auto &buffer_manager = BufferManager::GetBufferManager(context);
+	GlobalSortState global_sort(buffer_manager, orders, payload_layout);
+	LocalSortState local_sort;
+	local_sort.Initialize(global_sort, buffer_manager);
+
+	DataChunk payload;
+	payload.Initialize(Allocator::Get(context), payload_types);
+	for (auto &runs : gstate.batches) {
+		ColumnDataScanState scan_state;
+		runs->groups.InitializeScan(scan_state);
+		DataChunk groups;
+		runs->groups.InitializeScanChunk(groups);
+		idx_t offset = 0;
+		while (runs->groups.Scan(scan_state, groups)) {
+			payload.Reset();
+			for (idx_t col_idx = 0; col_idx < groups.ColumnCount(); col_idx++) {
+				payload.data[col_idx].Reference(groups.data[col_idx]);
+			}
+			auto pointer_data = FlatVector::GetData<uint64_t>(payload.data.back());
+			for (idx_t i = 0; i < groups.size(); i++) {
+				pointer_data[i] = CastPointerToValue(runs->states[offset + i]);
+			}
+			payload.SetCardinality(groups.size());
+			local_sort.SinkChunk(groups, payload);
+			offset += groups.size();
+		}
+	}
+	global_sort.AddLocalState(local_sort);
+	global_sort.PrepareMergePhase();
+	while (global_sort.sorted_blocks.size() > 1) {
+		global_sort.InitializeMergeRound();
+		MergeSorter merge_sorter(global_sort, buffer_manager);
+		merge_sorter.PerformInMergeRound();
+		global_sort.CompleteMergeRound();
+	}
+
+	PayloadScanner scanner(global_sort);
+	DataChunk sorted;
+	sorted.Initialize(Allocator::Get(context), payload_types);
+	DataChunk groups;
+	groups.InitializeEmpty(op.group_types);
+	data_ptr_t states[STANDARD_VECTOR_SIZE];
+	while (scanner.Remaining() > 0) {
+		sorted.Reset();
+		scanner.Scan(sorted);
+		if (sorted.size() == 0) {
+			break;
+		}
+		for (idx_t col_idx = 0; col_idx < groups.ColumnCount(); col_idx++) {
+			groups.data[col_idx].Reference(sorted.data[col_idx]);
+		}
+		groups.SetCardinality(sorted.size());
+		sorted.data.back().Flatten(sorted.size());
+		auto pointer_data = FlatVector::GetData<uint64_t>(sorted.data.back());
+		for (idx_t i = 0; i < sorted.size(); i++) {
+			states[i] = reinterpret_cast<data_ptr_t>(pointer_data[i]);
+		}
+		merger.Merge(groups, states);
+	}
+}
+
+SinkFinalizeType PhysicalOrderedAggregate::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+                                                    OperatorSinkFinalizeInput &input) const {
+	auto &gstate = input.global_state.Cast<OrderedAggregateGlobalSinkState>();
+	auto &batches = gstate.batches;
+	if (batches.empty()) {
+		return SinkFinalizeType::READY;
+	}
+	std::sort(batches.begin(), batches.end(),
+	          [](const unique_ptr<OrderedAggregateRuns> &a, const unique_ptr<OrderedAggregateRuns> &b) {
+		          return a->batch_index < b->batch_index;
+	          });
+
+	// the runs can be merged directly if every batch is ordered, and starts at or after the end of the batch before it
+	// this does not have to be verified if the input is known to be ordered on all groups
+	bool sorted = true;
+	SelectionVector new_runs(1);
+	for (idx_t batch_idx = 0; batch_idx < batches.size() && sorted && !input_ordered; batch_idx++) {
+		auto &runs = *batches[batch_idx];
+		sorted = runs.sorted;
+		if (sorted && batch_idx > 0) {
+			FindNewRuns(runs.first_group, batches[batch_idx - 1]->last_group, 0, new_runs, sorted);
+		}
+	}
+
+	OrderedAggregateMerger merger(context, *this, gstate.layout, gstate.allocator, *gstate.result);
+	if (sorted) {
+		MergeSortedRuns(context, *this, gstate, merger);
+	} else {
+		MergeUnsortedRuns(context, *this, gstate, merger);
+	}
+	merger.Finish();
+	return SinkFinalizeType::READY;
+}
+
+//===--------------------------------------------------------------------===//
+// Source
+//===--------------------------------------------------------------------===//
+class OrderedAggregateGlobalSourceState : public GlobalSourceState {
+public:
+	explicit OrderedAggregateGlobalSourceState(ColumnDataCollection &result) {
+		result.InitializeScan(scan_state);
+	}
+
+	ColumnDataScanState scan_state;
+};
+
+unique_ptr<GlobalSourceState> PhysicalOrderedAggregate::GetGlobalSourceState(ClientContext &context) const {
+	auto &gstate = sink_state->Cast<OrderedAggregateGlobalSinkState>();
+	return make_uniq<OrderedAggregateGlobalSourceState>(*gstate.result);
+}
+
+SourceResultType PhysicalOrderedAggregate::GetData(ExecutionContext &context, DataChunk &chunk,
+                                                   OperatorSourceInput &input) const {
+	auto &gstate = sink_state->Cast<OrderedAggregateGlobalSinkState>();
+	auto &state = input.global_state.Cast<OrderedAggregateGlobalSourceState>();
+
+	gstate.result->Scan(state.scan_state, chunk);
+	return chunk.size() == 0 ? SourceResultType::FINISHED : SourceResultType::HAVE_MORE_OUTPUT;
+}
+
+string PhysicalOrderedAggregate::ParamsToString() const {
+	string result;
+	for (idx_t i = 0; i < groups.size(); i++) {
+		if (i > 0) {
+			result += "\n";
+		}
+		result += groups[i]->GetName();
+	}
+	for (idx_t i = 0; i < aggregates.size(); i++) {
+		if (i > 0 || !groups.empty()) {
+			result += "\n";
+		}
+		result += aggregates[i]->GetName();
+		auto &aggregate = aggregates[i]->Cast<BoundAggregateExpression>();
+		if (aggregate.filter) {
+			result += " Filter: " + aggregate.filter->GetName();
+		}
+	}
+	return result;
+}
+
+} // namespace duckdb
@@ -1,5 +1,6 @@
 #include "duckdb/execution/operator/aggregate/physical_streaming_window.hpp"
 
+#include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/function/aggregate_function.hpp"
 #include "duckdb/parallel/thread_context.hpp"
@@ -13,6 +14,63 @@ PhysicalStreamingWindow::PhysicalStreamingWindow(vector<LogicalType> types, vect
     : PhysicalOperator(type, std::move(types), estimated_cardinality), select_list(std::move(select_list)) {
 }
 
+//! Evaluate a constant row offset that is small enough to buffer the preceding rows between chunks
+static bool TryGetStreamingOffset(ClientContext &context, const unique_ptr<Expression> &expr, idx_t &offset) {
+	if (!expr) {
+		// LAG defaults to the previous row
+		offset = 1;
+		return true;
+	}
+	if (!expr->IsFoldable()) {
+		return false;
+	}
+	Value value;
+	if (!ExpressionExecutor::TryEvaluateScalar(context, *expr, value) || value.IsNull() ||
+	    !value.DefaultTryCastAs(LogicalType::BIGINT)) {
+		return false;
+	}
+	const auto signed_offset = value.GetValue<int64_t>();
+	if (signed_offset < 0 || idx_t(signed_offset) > PhysicalStreamingWindow::MAX_BUFFERED_ROWS) {
+		return false;
+	}
+	offset = idx_t(signed_offset);
+	return true;
+}
+
+bool PhysicalStreamingWindow::IsStreamingFunction(ClientContext &context, unique_ptr<Expression> &expr) {
+	auto &wexpr = expr->Cast<BoundWindowExpression>();
+	if (!wexpr.partitions.empty() || !wexpr.orders.empty() || wexpr.ignore_nulls ||
+	    wexpr.exclude_clause != WindowExcludeMode::NO_OTHER) {
+		return false;
+	}
+	idx_t offset;
+	switch (wexpr.type) {
+	case ExpressionType::WINDOW_AGGREGATE:
+		// We can stream aggregates if they are "running totals" and don't use filters
+		if (wexpr.end != WindowBoundary::CURRENT_ROW_ROWS || wexpr.filter_expr) {
+			return false;
+		}
+		if (wexpr.start == WindowBoundary::UNBOUNDED_PRECEDING) {
+			return true;
+		}
+		// Or if they only look back a constant number of rows
+		return wexpr.start == WindowBoundary::EXPR_PRECEDING_ROWS && !wexpr.distinct &&
+		       TryGetStreamingOffset(context, wexpr.start_expr, offset);
+	case ExpressionType::WINDOW_LAG:
+		// LAG only needs the preceding rows, LEAD would have to delay the output
+		return TryGetStreamingOffset(context, wexpr.offset_expr, offset) &&
+		       (!wexpr.default_expr || wexpr.default_expr->IsFoldable());
+	case ExpressionType::WINDOW_FIRST_VALUE:
+	case ExpressionType::WINDOW_PERCENT_RANK:
+	case ExpressionType::WINDOW_RANK:
+	case ExpressionType::WINDOW_RANK_DENSE:
+	case ExpressionType::WINDOW_ROW_NUMBER:
+		return true;
+	default:
+		return false;
+	}
+}
+
 class StreamingWindowGlobalState : public GlobalOperatorState {
 public:
 	StreamingWindowGlobalState() : row_number(1) {
@@ -22,6 +80,132 @@ public:
 	std::atomic<int64_t> row_number;
 };
 
+//! Aggregates the frame of ROWS n PRECEDING with two stacks of states, so every row is only updated and combined a
+//! constant number of times (amortized). The back state aggregates the newest rows of the frame, and the front holds
+//! the aggregate of every suffix of the older rows (in a ring of states indexed by the row number).
+class StreamingWindowFrame {
+public:
+	StreamingWindowFrame(const BoundWindowExpression &wexpr, idx_t offset, ArenaAllocator &allocator)
+	    : aggregate(*wexpr.aggregate), aggr_input_data(wexpr.bind_info.get(), allocator), frame_size(offset + 1),
+	      state_size(AlignValue(aggregate.state_size())), states((frame_size + 2) * state_size), rows(0),
+	      front_count(0), back_count(0), source(LogicalType::POINTER, data_ptr_cast(&source_ptr)),
+	      target(LogicalType::POINTER, data_ptr_cast(&target_ptr)) {
+		aggregate.initialize(BackState());
+	}
+
+	~StreamingWindowFrame() {
+		for (idx_t i = 0; i < front_count; ++i) {
+			Destroy(FrontState(rows - back_count - front_count + i));
+		}
+		Destroy(BackState());
+	}
+
+	//! Aggregates the frames of the rows [begin, begin + count) of the buffer, which are preceded by the history
+	void Aggregate(Allocator &allocator, DataChunk &buffer, idx_t begin, idx_t count, Vector &result) {
+		// Iterate through the buffer using a single SV
+		DataChunk row;
+		row.Initialize(allocator, buffer.GetTypes());
+		sel_t s = 0;
+		SelectionVector sel(&s);
+		row.Slice(sel, 1);
+		for (idx_t col_idx = 0; col_idx < buffer.ColumnCount(); ++col_idx) {
+			DictionaryVector::Child(row.data[col_idx]).Reference(buffer.data[col_idx]);
+		}
+		for (idx_t i = 0; i < count; ++i) {
+			const auto row_idx = begin + i;
+			if (front_count + back_count == frame_size) {
+				// The oldest row leaves the frame
+				if (front_count == 0) {
+					Flip(row, sel, row_idx);
+				} else {
+					Destroy(FrontState(rows - back_count - front_count));
+					front_count--;
+				}
+			}
+			sel.set_index(0, row_idx);
+			Update(row, BackState());
+			rows++;
+			back_count++;
+			if (front_count == 0) {
+				Finalize(BackState(), result, i);
+				continue;
+			}
+			auto temp = TempState();
+			aggregate.initialize(temp);
+			Combine(FrontState(rows - back_count - front_count), temp);
+			Combine(BackState(), temp);
+			Finalize(temp, result, i);
+			Destroy(temp);
+		}
+	}
+
+private:
+	//! Moves the rows of the back, except for the oldest one, to the front
+	void Flip(DataChunk &row, SelectionVector &sel, idx_t row_idx) {
+		// The back holds the rows that directly precede row_idx, aggregate their suffixes starting from the newest
+		for (idx_t k = 0; k + 1 < back_count; ++k) {
+			auto state = FrontState(rows - 1 - k);
+			aggregate.initialize(state);
+			sel.set_index(0, row_idx - 1 - k);
+			Update(row, state);
+			if (k > 0) {
+				Combine(FrontState(rows - k), state);
+			}
+		}
+		front_count = back_count - 1;
+		back_count = 0;
+		Destroy(BackState());
+		aggregate.initialize(BackState());
+	}
+
+	data_ptr_t FrontState(idx_t row_number) {
+		return states.data() + (row_number % frame_size) * state_size;
+	}
+	data_ptr_t BackState() {
+		return states.data() + frame_size * state_size;
+	}
+	data_ptr_t TempState() {
+		return states.data() + (frame_size + 1) * state_size;
+	}
+
+	void Update(DataChunk &row, data_ptr_t state) {
+		target_ptr = state;
+		aggregate.update(row.data.data(), aggr_input_data, row.ColumnCount(), target, 1);
+	}
+	void Combine(data_ptr_t source_state, data_ptr_t target_state) {
+		source_ptr = source_state;
+		target_ptr = target_state;
+		aggregate.combine(source, target, aggr_input_data, 1);
+	}
+	void Finalize(data_ptr_t state, Vector &result, idx_t result_idx) {
+		target_ptr = state;
+		aggregate.finalize(target, aggr_input_data, result, 1, result_idx);
+	}
+	void Destroy(data_ptr_t state) {
+		if (aggregate.destructor) {
+			target_ptr = state;
+			aggregate.destructor(target, aggr_input_data, 1);
+		}
+	}
+
+private:
+	const AggregateFunction &aggregate;
+	AggregateInputData aggr_input_data;
+	//! The number of rows in a full frame
+	const idx_t frame_size;
+	const idx_t state_size;
+	//! The ring of front states, followed by the back state and a temporary state
+	vector<data_t> states;
+	//! The number of rows that have been aggregated
+	idx_t rows;
+	idx_t front_count;
+	idx_t back_count;
+	data_ptr_t source_ptr;
+	data_ptr_t target_ptr;
+	Vector source;
+	Vector target;
+};
+
 class StreamingWindowState : public OperatorState {
 public:
 	using StateBuffer = vector<data_t>;
@@ -47,6 +231,10 @@ public:
 		aggregate_states.resize(expressions.size());
 		aggregate_bind_data.resize(expressions.size(), nullptr);
 		aggregate_dtors.resize(expressions.size(), nullptr);
+		offsets.resize(expressions.size(), 0);
+		histories.resize(expressions.size());
+		buffers.resize(expressions.size());
+		frames.resize(expressions.size());
 
 		for (idx_t expr_idx = 0; expr_idx < expressions.size(); expr_idx++) {
 			auto &expr = *expressions[expr_idx];
@@ -59,6 +247,29 @@ public:
 				aggregate_dtors[expr_idx] = aggregate.destructor;
 				state.resize(aggregate.state_size());
 				aggregate.initialize(state.data());
+				if (wexpr.start == WindowBoundary::EXPR_PRECEDING_ROWS) {
+					auto offset = ExpressionExecutor::EvaluateScalar(context, *wexpr.start_expr);
+					offsets[expr_idx] = offset.DefaultCastAs(LogicalType::BIGINT).GetValue<int64_t>();
+					InitializeBuffers(context, expr_idx, wexpr);
+					if (!wexpr.children.empty()) {
+						frames[expr_idx] = make_uniq<StreamingWindowFrame>(wexpr, offsets[expr_idx], allocator);
+					}
+				}
+				break;
+			}
+			case ExpressionType::WINDOW_LAG: {
+				if (wexpr.offset_expr) {
+					auto offset = ExpressionExecutor::EvaluateScalar(context, *wexpr.offset_expr);
+					offsets[expr_idx] = offset.DefaultCastAs(LogicalType::BIGINT).GetValue<int64_t>();
+				} else {
+					offsets[expr_idx] = 1;
+				}
+				Value dflt(wexpr.return_type);
+				if (wexpr.default_expr) {
+					dflt = ExpressionExecutor::EvaluateScalar(context, *wexpr.default_expr);
+				}
+				const_vectors[expr_idx] = make_uniq<Vector>(dflt);
+				InitializeBuffers(context, expr_idx, wexpr);
 				break;
 			}
 			case ExpressionType::WINDOW_FIRST_VALUE: {
@@ -88,6 +299,42 @@ public:
 		initialized = true;
 	}
 
+	void InitializeBuffers(ClientContext &context, idx_t expr_idx, const BoundWindowExpression &wexpr) {
+		vector<LogicalType> payload_types;
+		for (auto &child : wexpr.children) {
+			payload_types.push_back(child->return_type);
+		}
+		if (payload_types.empty()) {
+			// COUNT(*) only needs the row numbers
+			return;
+		}
+		auto &allocator = Allocator::Get(context);
+		histories[expr_idx] = make_uniq<DataChunk>();
+		histories[expr_idx]->Initialize(allocator, payload_types);
+		buffers[expr_idx] = make_uniq<DataChunk>();
+		buffers[expr_idx]->Initialize(allocator, payload_types);
+	}
+
+	//! Prepend the rows carried over from the previous chunk to the arguments of this chunk
+	DataChunk &BufferPayload(idx_t expr_idx, DataChunk &payload) {
+		auto &history = *histories[expr_idx];
+		auto &buffer = *buffers[expr_idx];
+		buffer.Reset();
+		buffer.Append(history, true);
+		buffer.Append(payload, true);
+
+		// Carry the last rows over to the next chunk
+		const auto count = buffer.size();
+		const auto keep = MinValue<idx_t>(offsets[expr_idx], count);
+		history.Reset();
+		for (idx_t col_idx = 0; col_idx < buffer.ColumnCount(); ++col_idx) {
+			VectorOperations::Copy(buffer.data[col_idx], history.data[col_idx], count, count - keep, 0);
+		}
+		history.SetCardinality(keep);
+
+		return buffer;
+	}
+
 public:
 	bool initialized;
 	vector<unique_ptr<Vector>> const_vectors;
@@ -99,6 +346,16 @@ public:
 	vector<aggregate_destructor_t> aggregate_dtors;
 	data_ptr_t state_ptr;
 	Vector statev;
+
+	// Preceding rows
+	//! The LAG offset or the number of preceding rows in the frame
+	vector<idx_t> offsets;
+	//! The arguments of the last rows of the previous chunk
+	vector<unique_ptr<DataChunk>> histories;
+	//! The arguments of the history followed by the current chunk
+	vector<unique_ptr<DataChunk>> buffers;
+	//! The frame states of ROWS n PRECEDING aggregates
+	vector<unique_ptr<StreamingWindowFrame>> frames;
 };
 
 unique_ptr<GlobalOperatorState> PhysicalStreamingWindow::GetGlobalOperatorState(ClientContext &context) const {
@@ -109,6 +366,71 @@ unique_ptr<OperatorState> PhysicalStreamingWindow::GetOperatorState(ExecutionCon
 	return make_uniq<StreamingWindowState>();
 }
 
+static void ExecutePayload(ExecutionContext &context, const BoundWindowExpression &wexpr, DataChunk &input,
+                           DataChunk &payload) {
+	ExpressionExecutor executor(context.client);
+	vector<LogicalType> payload_types;
+	for (auto &child : wexpr.children) {
+		payload_types.push_back(child->return_type);
+		executor.AddExpression(*child);
+	}
+	payload.Initialize(Allocator::Get(context.client), payload_types);
+	executor.Execute(input, payload);
+}
+
+void PhysicalStreamingWindow::ExecuteLag(ExecutionContext &context, DataChunk &input, Vector &result,
+                                         OperatorState &state_p, idx_t expr_idx) const {
+	auto &state = state_p.Cast<StreamingWindowState>();
+	auto &wexpr = select_list[expr_idx]->Cast<BoundWindowExpression>();
+
+	DataChunk payload;
+	ExecutePayload(context, wexpr, input, payload);
+	const auto history_count = state.histories[expr_idx]->size();
+	auto &buffer = state.BufferPayload(expr_idx, payload);
+
+	//	Row i of the chunk is row (history_count + i) of the buffer,
+	//	so it lags row (history_count + i - offset), if there is one.
+	const auto count = input.size();
+	const auto offset = state.offsets[expr_idx];
+	const auto missing = MinValue<idx_t>(offset > history_count ? offset - history_count : 0, count);
+	auto &dflt = *state.const_vectors[expr_idx];
+	for (idx_t i = 0; i < missing; ++i) {
+		VectorOperations::Copy(dflt, result, 1, 0, i);
+	}
+	if (missing < count) {
+		const auto source_offset = history_count + missing - offset;
+		VectorOperations::Copy(buffer.data[0], result, source_offset + count - missing, source_offset, missing);
+	}
+}
+
+void PhysicalStreamingWindow::ExecuteFrameAggregate(ExecutionContext &context, DataChunk &input, Vector &result,
+                                                    GlobalOperatorState &gstate_p, OperatorState &state_p,
+                                                    idx_t expr_idx) const {
+	auto &gstate = gstate_p.Cast<StreamingWindowGlobalState>();
+	auto &state = state_p.Cast<StreamingWindowState>();
+	auto &wexpr = select_list[expr_idx]->Cast<BoundWindowExpression>();
+	const auto offset = state.offsets[expr_idx];
+	const auto count = input.size();
+
+	// Check for COUNT(*)
+	if (wexpr.children.empty()) {
+		D_ASSERT(GetTypeIdSize(result.GetType().InternalType()) == sizeof(int64_t));
+		auto data = FlatVector::GetData<int64_t>(result);
+		const auto preceding = idx_t(gstate.row_number - 1);
+		for (idx_t i = 0; i < count; ++i) {
+			data[i] = NumericCast<int64_t>(MinValue<idx_t>(preceding + i, offset) + 1);
+		}
+		return;
+	}
+
+	DataChunk payload;
+	ExecutePayload(context, wexpr, input, payload);
+	const auto history_count = state.histories[expr_idx]->size();
+	auto &buffer = state.BufferPayload(expr_idx, payload);
+
+	state.frames[expr_idx]->Aggregate(Allocator::Get(context.client), buffer, history_count, count, result);
+}
+
 OperatorResultType PhysicalStreamingWindow::Execute(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
                                                     GlobalOperatorState &gstate_p, OperatorState &state_p) const {
 	auto &gstate = gstate_p.Cast<StreamingWindowGlobalState>();
@@ -129,8 +451,12 @@ OperatorResultType PhysicalStreamingWindow::Execute(ExecutionContext &context, D
 		auto &result = chunk.data[col_idx];
 		switch (expr.GetExpressionType()) {
 		case ExpressionType::WINDOW_AGGREGATE: {
-			//	Establish the aggregation environment
 			auto &wexpr = expr.Cast<BoundWindowExpression>();
+			if (wexpr.start == WindowBoundary::EXPR_PRECEDING_ROWS) {
+				ExecuteFrameAggregate(context, input, result, gstate, state, expr_idx);
+				break;
+			}
+			//	Establish the aggregation environment
 			auto &aggregate = *wexpr.aggregate;
 			auto &statev = state.statev;
 			state.state_ptr = state.aggregate_states[expr_idx].data();
@@ -187,6 +513,9 @@ OperatorResultType PhysicalStreamingWindow::Execute(ExecutionContext &context, D
 			chunk.data[col_idx].Reference(*state.const_vectors[expr_idx]);
 			break;
 		}
+		case ExpressionType::WINDOW_LAG:
+			ExecuteLag(context, input, result, state, expr_idx);
+			break;
 		case ExpressionType::WINDOW_ROW_NUMBER: {
 			// Set row numbers
 			int64_t start_row = gstate.row_number;
@@ -268,6 +268,7 @@ public:
 	unique_ptr<RowDataCollectionScanner> GetScanner() const;
 	void MaterializeSortedData();
 	void BuildPartition(WindowGlobalSinkState &gstate, const idx_t hash_bin);
+	void BuildExecutors();
 
 	ClientContext &context;
 	const PhysicalWindow &op;
@@ -437,7 +438,8 @@ void WindowPartitionSourceState::BuildPartition(WindowGlobalSinkState &gstate, c
 		input_idx += input_chunk.size();
 	}
 
-	//	TODO: Parallelization opportunity
+	//	The expensive parts of the finalisation (e.g., the segment tree levels)
+	//	are deferred to BuildExecutors, which is shared by all the threads that scan the partition.
 	for (auto &wexec : executors) {
 		wexec->Finalize();
 	}
@@ -449,6 +451,12 @@ void WindowPartitionSourceState::BuildPartition(WindowGlobalSinkState &gstate, c
 	unscanned = rows->blocks.size();
 }
 
+void WindowPartitionSourceState::BuildExecutors() {
+	for (auto &wexec : executors) {
+		wexec->Build();
+	}
+}
+
 // Per-thread scan state
 class WindowLocalSourceState : public LocalSourceState {
 public:
@@ -612,6 +620,10 @@ bool WindowLocalSourceState::NextPartition() {
 		UpdateBatchIndex();
 	}
 
+	//	Help build the partition before evaluating it.
+	//	This is where a single large partition is split over all the threads
+	partition_source->BuildExecutors();
+
 	for (auto &wexec : partition_source->executors) {
 		read_states.emplace_back(wexec->GetExecutorState());
 	}
@@ -5,6 +5,8 @@
 #include "duckdb/main/client_data.hpp"
 #include "duckdb/common/operator/integer_cast_operator.hpp"
 #include "duckdb/common/operator/double_cast_operator.hpp"
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/storage/table/column_segment.hpp"
 #include <algorithm>
 #include "utf8proc_wrapper.hpp"
 
@@ -723,63 +725,133 @@ void StringValueScanner::Flush(DataChunk &insert_chunk) {
 	D_ASSERT(csv_file_scan);
 
 	auto &reader_data = csv_file_scan->reader_data;
-	// Now Do the cast-aroo
-	for (idx_t c = 0; c < reader_data.column_ids.size(); c++) {
-		idx_t col_idx = c;
-		idx_t result_idx = reader_data.column_mapping[c];
-		if (!csv_file_scan->projection_ids.empty()) {
-			result_idx = reader_data.column_mapping[csv_file_scan->projection_ids[c].second];
-		}
-		if (col_idx >= parse_chunk.ColumnCount()) {
-			throw InvalidInputException("Mismatch between the schema of different files");
-		}
-		auto &parse_vector = parse_chunk.data[col_idx];
-		auto &result_vector = insert_chunk.data[result_idx];
-		auto &type = result_vector.GetType();
-		auto &parse_type = parse_vector.GetType();
-		if (type == LogicalType::VARCHAR || (type != LogicalType::VARCHAR && parse_type != LogicalType::VARCHAR)) {
-			// reinterpret rather than reference
-			result_vector.Reinterpret(parse_vector);
-		} else {
-			string error_message;
-			CastParameters parameters(false, &error_message);
-			bool success;
-			idx_t line_error = 0;
-			bool line_error_set = true;
-			if (state_machine->options.decimal_separator != "." && type.id() == LogicalTypeId::DECIMAL) {
-				success =
-				    CSVCast::TryCastDecimalVectorCommaSeparated(state_machine->options, parse_vector, result_vector,
-				                                                parse_chunk.size(), parameters, type, line_error);
+	const idx_t column_count = reader_data.column_ids.size();
+	if (column_count > parse_chunk.ColumnCount()) {
+		throw InvalidInputException("Mismatch between the schema of different files");
+	}
+	vector<idx_t> result_indexes(column_count);
+	for (idx_t col_idx = 0; col_idx < column_count; col_idx++) {
+		result_indexes[col_idx] = csv_file_scan->GetResultIndex(col_idx);
+	}
 
-			} else {
-				// target type is not varchar: perform a cast
-				success = VectorOperations::TryCast(buffer_manager->context, parse_vector, result_vector,
-				                                    parse_chunk.size(), &error_message, false, true);
-				line_error_set = false;
+	for (idx_t col_idx = 0; col_idx < column_count; col_idx++) {
+		ConvertColumn(parse_chunk, col_idx, insert_chunk.data[result_indexes[col_idx]], borked_lines);
+	}
+	if (!borked_lines.empty()) {
+		// We must remove the borked lines from our chunk
+		SelectionVector succesful_rows(parse_chunk.size() - borked_lines.size());
+		idx_t sel_idx = 0;
+		for (idx_t row_idx = 0; row_idx < parse_chunk.size(); row_idx++) {
+			if (borked_lines.find(row_idx) == borked_lines.end()) {
+				succesful_rows.set_index(sel_idx++, row_idx);
 			}
-			if (success) {
-				continue;
+		}
+		// Now we slice the result
+		insert_chunk.Slice(succesful_rows, sel_idx);
+	}
+
+	// If filters were pushed into the scan, we apply them to the converted chunk
+	// All rows are converted first, so a value that cannot be converted is an error whether or not its row is filtered
+	SelectionVector sel;
+	sel.Initialize(nullptr);
+	idx_t approved_count = insert_chunk.size();
+	for (idx_t col_idx = 0; col_idx < column_count && approved_count > 0; col_idx++) {
+		auto filter = csv_file_scan->GetColumnFilter(col_idx);
+		if (filter) {
+			ApplyFilter(insert_chunk.data[result_indexes[col_idx]], *filter, insert_chunk.size(), sel, approved_count);
+		}
+	}
+	if (approved_count == 0) {
+		// nothing passed: reset the chunk, as it might be flushed into again
+		insert_chunk.Reset();
+	} else if (approved_count < insert_chunk.size()) {
+		insert_chunk.Slice(sel, approved_count);
+	}
+}
+
+void StringValueScanner::ApplyFilter(Vector &vector, const TableFilter &filter, idx_t count, SelectionVector &sel,
+                                     idx_t &approved_count) {
+	UnifiedVectorFormat vdata;
+	vector.ToUnifiedFormat(count, vdata);
+	ColumnSegment::FilterSelection(sel, vector, vdata, filter, count, approved_count);
+}
+
+void StringValueScanner::ConvertColumn(DataChunk &parse_chunk, idx_t col_idx, Vector &result_vector,
+                                       unordered_set<idx_t> &borked_lines) {
+	auto &parse_vector = parse_chunk.data[col_idx];
+	const auto count = parse_chunk.size();
+	auto &type = result_vector.GetType();
+	auto &parse_type = parse_vector.GetType();
+	if (type == LogicalType::VARCHAR || (type != LogicalType::VARCHAR && parse_type != LogicalType::VARCHAR)) {
+		// reinterpret rather than reference
+		result_vector.Reinterpret(parse_vector);
+	} else {
+		string error_message;
+		CastParameters parameters(false, &error_message);
+		bool success;
+		idx_t line_error = 0;
+		bool line_error_set = true;
+		if (state_machine->options.decimal_separator != "." && type.id() == LogicalTypeId::DECIMAL) {
+			success = CSVCast::TryCastDecimalVectorCommaSeparated(state_machine->options, parse_vector, result_vector,
+			                                                      count, parameters, type, line_error);
+
+		} else {
+			// target type is not varchar: perform a cast
+			success = VectorOperations::TryCast(buffer_manager->context, parse_vector, result_vector, count,
+			                                    &error_message, false, true);
+			line_error_set = false;
+		}
+		if (success) {
+			return;
+		}
+		// An error happened, to propagate it we need to figure out the exact line where the casting failed.
+		UnifiedVectorFormat inserted_column_data;
+		result_vector.ToUnifiedFormat(count, inserted_column_data);
+		UnifiedVectorFormat parse_column_data;
+		parse_vector.ToUnifiedFormat(count, parse_column_data);
+		if (!line_error_set) {
+			for (; line_error < count; line_error++) {
+				if (!inserted_column_data.validity.RowIsValid(line_error) &&
+				    parse_column_data.validity.RowIsValid(line_error)) {
+					break;
+				}
 			}
-			// An error happened, to propagate it we need to figure out the exact line where the casting failed.
-			UnifiedVectorFormat inserted_column_data;
-			result_vector.ToUnifiedFormat(parse_chunk.size(), inserted_column_data);
-			UnifiedVectorFormat parse_column_data;
-			parse_vector.ToUnifiedFormat(parse_chunk.size(), parse_column_data);
-			if (!line_error_set) {
-				for (; line_error < parse_chunk.size(); line_error++) {
-					if (!inserted_column_data.validity.RowIsValid(line_error) &&
-					    parse_column_data.validity.RowIsValid(line_error)) {
-						break;
-					}
+		}
+		{
+			vector<Value> row;
+
+			if (state_machine->options.ignore_errors.GetValue()) {
+				for (idx_t col = 0; col < parse_chunk.ColumnCount(); col++) {
+					row.push_back(parse_chunk.GetValue(col, line_error));
 				}
 			}
-			{
+			if (!state_machine->options.IgnoreErrors()) {
+				LinesPerBoundary lines_per_batch(iterator.GetBoundaryIdx(), lines_read - parse_chunk.size() + line_error);
+				bool first_nl;
+				auto borked_line =
+				    result.line_positions_per_row[line_error].ReconstructCurrentLine(first_nl, result.buffer_handles);
+				std::ostringstream error;
+				error << "Could not convert string \"" << parse_vector.GetValue(line_error) << "\" to \'"
+				      << LogicalTypeIdToString(type.id()) << "\'";
+				string error_msg = error.str();
+				auto csv_error = CSVError::CastError(
+				    state_machine->options, csv_file_scan->names[col_idx], error_msg, col_idx, borked_line,
+				    lines_per_batch,
+				    result.line_positions_per_row[line_error].begin.GetGlobalPosition(result.result_size, first_nl),
+				    optional_idx::Invalid(), result_vector.GetType().id());
+				error_handler->Error(csv_error);
+			}
+		}
+		borked_lines.insert(line_error++);
+		D_ASSERT(state_machine->options.ignore_errors.GetValue());
+		// We are ignoring errors. We must continue but ignoring borked rows
+		for (; line_error < count; line_error++) {
+			if (!inserted_column_data.validity.RowIsValid(line_error) &&
+			    parse_column_data.validity.RowIsValid(line_error)) {
+				borked_lines.insert(line_error);
 				vector<Value> row;
-
-				if (state_machine->options.ignore_errors.GetValue()) {
-					for (idx_t col = 0; col < parse_chunk.ColumnCount(); col++) {
-						row.push_back(parse_chunk.GetValue(col, line_error));
-					}
+				for (idx_t col = 0; col < parse_chunk.ColumnCount(); col++) {
+					row.push_back(parse_chunk.GetValue(col, line_error));
 				}
 				if (!state_machine->options.IgnoreErrors()) {
 					LinesPerBoundary lines_per_batch(iterator.GetBoundaryIdx(),
@@ -788,63 +860,21 @@ void StringValueScanner::Flush(DataChunk &insert_chunk) {
 					auto borked_line = result.line_positions_per_row[line_error].ReconstructCurrentLine(
 					    first_nl, result.buffer_handles);
 					std::ostringstream error;
+					// Casting Error Message
 					error << "Could not convert string \"" << parse_vector.GetValue(line_error) << "\" to \'"
 					      << LogicalTypeIdToString(type.id()) << "\'";
 					string error_msg = error.str();
-					auto csv_error = CSVError::CastError(
-					    state_machine->options, csv_file_scan->names[col_idx], error_msg, col_idx, borked_line,
-					    lines_per_batch,
-					    result.line_positions_per_row[line_error].begin.GetGlobalPosition(result.result_size, first_nl),
-					    optional_idx::Invalid(), result_vector.GetType().id());
+					auto csv_error =
+					    CSVError::CastError(state_machine->options, csv_file_scan->names[col_idx], error_msg,
+					                        col_idx, borked_line, lines_per_batch,
+					                        result.line_positions_per_row[line_error].begin.GetGlobalPosition(
+					                            result.result_size, first_nl),
+					                        optional_idx::Invalid(), result_vector.GetType().id());
 					error_handler->Error(csv_error);
 				}
 			}
-			borked_lines.insert(line_error++);
-			D_ASSERT(state_machine->options.ignore_errors.GetValue());
-			// We are ignoring errors. We must continue but ignoring borked rows
-			for (; line_error < parse_chunk.size(); line_error++) {
-				if (!inserted_column_data.validity.RowIsValid(line_error) &&
-				    parse_column_data.validity.RowIsValid(line_error)) {
-					borked_lines.insert(line_error);
-					vector<Value> row;
-					for (idx_t col = 0; col < parse_chunk.ColumnCount(); col++) {
-						row.push_back(parse_chunk.GetValue(col, line_error));
-					}
-					if (!state_machine->options.IgnoreErrors()) {
-						LinesPerBoundary lines_per_batch(iterator.GetBoundaryIdx(),
-						                                 lines_read - parse_chunk.size() + line_error);
-						bool first_nl;
-						auto borked_line = result.line_positions_per_row[line_error].ReconstructCurrentLine(
-						    first_nl, result.buffer_handles);
-						std::ostringstream error;
-						// Casting Error Message
-						error << "Could not convert string \"" << parse_vector.GetValue(line_error) << "\" to \'"
-						      << LogicalTypeIdToString(type.id()) << "\'";
-						string error_msg = error.str();
-						auto csv_error =
-						    CSVError::CastError(state_machine->options, csv_file_scan->names[col_idx], error_msg,
-						                        col_idx, borked_line, lines_per_batch,
-						                        result.line_positions_per_row[line_error].begin.GetGlobalPosition(
-						                            result.result_size, first_nl),
-						                        optional_idx::Invalid(), result_vector.GetType().id());
-						error_handler->Error(csv_error);
-					}
-				}
-			}
 		}
 	}
-	if (!borked_lines.empty()) {
-		// We must remove the borked lines from our chunk
-		SelectionVector succesful_rows(parse_chunk.size() - borked_lines.size());
-		idx_t sel_idx = 0;
-		for (idx_t row_idx = 0; row_idx < parse_chunk.size(); row_idx++) {
-			if (borked_lines.find(row_idx) == borked_lines.end()) {
-				succesful_rows.set_index(sel_idx++, row_idx);
-			}
-		}
-		// Now we slice the result
-		insert_chunk.Slice(succesful_rows, sel_idx);
-	}
 }
 
 void StringValueScanner::Initialize() {
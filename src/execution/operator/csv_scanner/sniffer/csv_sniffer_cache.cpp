@@ -0,0 +1,106 @@
+#include "duckdb/execution/operator/csv_scanner/csv_sniffer_cache.hpp"
+#include "duckdb/common/serializer/binary_serializer.hpp"
+#include "duckdb/common/serializer/memory_stream.hpp"
+
+#include <chrono>
+
+namespace duckdb {
+
+CSVSnifferCache &CSVSnifferCache::Get(ClientContext &context) {
+	auto &cache = ObjectCache::GetObjectCache(context);
+	return *cache.GetOrCreate<CSVSnifferCache>(CSVSnifferCache::ObjectType());
+}
+
+string CSVSnifferCache::GetKey(const string &file_path, const CSVReaderOptions &options, SetColumns &set_columns) {
+	// The serialized options cover the dialect, the sniffing parameters and everything the sniffer has set so far
+	MemoryStream stream;
+	BinarySerializer::Serialize(options, stream);
+	string key = file_path;
+	key += '\0';
+	key += string(const_char_ptr_cast(stream.GetData()), stream.GetPosition());
+	// The options that are used by the sniffer, but are not serialized
+	key += '\0';
+	key += options.user_defined_parameters;
+	for (auto &type : options.sql_type_list) {
+		key += '\0' + type.ToString();
+	}
+	for (auto &entry : options.sql_types_per_column) {
+		key += '\0' + entry.first + '=' + to_string(entry.second);
+	}
+	for (auto &name : options.name_list) {
+		key += '\0' + name;
+	}
+	for (auto &type : options.auto_type_candidates) {
+		key += '\0' + type.ToString();
+	}
+	key += '\0';
+	for (idx_t i = 0; i < set_columns.Size(); i++) {
+		key += '\0' + (*set_columns.names)[i] + ' ' + (*set_columns.types)[i].ToString();
+	}
+	return key;
+}
+
+shared_ptr<CSVSnifferCacheEntry> CSVSnifferCache::Find(const string &key) {
+	lock_guard<mutex> parallel_lock(main_mutex);
+	auto it = sniffer_cache.find(key);
+	if (it == sniffer_cache.end()) {
+		return nullptr;
+	}
+	lru.splice(lru.begin(), lru, it->second.second);
+	return it->second.first;
+}
+
+void CSVSnifferCache::Insert(const string &key, shared_ptr<CSVSnifferCacheEntry> entry) {
+	lock_guard<mutex> parallel_lock(main_mutex);
+	auto it = sniffer_cache.find(key);
+	if (it != sniffer_cache.end()) {
+		it->second.first = std::move(entry);
+		lru.splice(lru.begin(), lru, it->second.second);
+		return;
+	}
+	if (sniffer_cache.size() >= MAX_ENTRIES) {
+		sniffer_cache.erase(lru.back());
+		lru.pop_back();
+	}
+	lru.push_front(key);
+	sniffer_cache[key] = make_pair(std::move(entry), lru.begin());
+}
+
+SnifferResult CSVSnifferCache::SniffCSV(ClientContext &context, CSVReaderOptions &options,
+                                        shared_ptr<CSVBufferManager> buffer_manager, SetColumns set_columns,
+                                        bool force_match) {
+	auto &state_machine_cache = CSVStateMachineCache::Get(context);
+	auto &file_handle = *buffer_manager->file_handle;
+	// We can only tell whether a file has changed if we can seek in it (i.e., it is not a pipe or compressed)
+	if (!ObjectCache::ObjectCacheEnabled(context) || !file_handle.CanSeek() || file_handle.IsPipe()) {
+		CSVSniffer sniffer(options, std::move(buffer_manager), state_machine_cache, set_columns);
+		return sniffer.SniffCSV(force_match);
+	}
+	auto &cache = CSVSnifferCache::Get(context);
+	auto key = GetKey(buffer_manager->GetFilePath(), options, set_columns);
+	auto file_size = file_handle.FileSize();
+	auto last_modified = file_handle.LastModifiedTime();
+	auto entry = cache.Find(key);
+	// Files that were modified shortly before they were sniffed might have been modified again since, without a
+	// change in the modification time
+	if (entry && entry->file_size == file_size && entry->last_modified == last_modified &&
+	    last_modified + 10 < entry->read_time) {
+		options.dialect_options = entry->dialect_options;
+		options.sniffer_user_mismatch_error = entry->sniffer_user_mismatch_error;
+		options.was_type_manually_set = entry->was_type_manually_set;
+		options.auto_detect = true;
+		if (!options.sniffer_user_mismatch_error.empty() && force_match) {
+			throw InvalidInputException(options.sniffer_user_mismatch_error);
+		}
+		return entry->result;
+	}
+
+	auto read_time = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+	CSVSniffer sniffer(options, std::move(buffer_manager), state_machine_cache, set_columns);
+	auto result = sniffer.SniffCSV(force_match);
+	entry = make_shared_ptr<CSVSnifferCacheEntry>(result, options, file_size, last_modified, read_time);
+	cache.Insert(key, std::move(entry));
+	return result;
+}
+
+} // namespace duckdb
@@ -1,13 +1,14 @@
 #include "duckdb/execution/operator/csv_scanner/csv_file_scanner.hpp"
 #include "duckdb/function/table/read_csv.hpp"
-#include "duckdb/execution/operator/csv_scanner/csv_sniffer.hpp"
+#include "duckdb/execution/operator/csv_scanner/csv_sniffer_cache.hpp"
+#include "duckdb/planner/table_filter.hpp"
 
 namespace duckdb {
 
 CSVFileScan::CSVFileScan(ClientContext &context, shared_ptr<CSVBufferManager> buffer_manager_p,
                          shared_ptr<CSVStateMachine> state_machine_p, const CSVReaderOptions &options_p,
                          const ReadCSVData &bind_data, const vector<column_t> &column_ids,
-                         vector<LogicalType> &file_schema)
+                         vector<LogicalType> &file_schema, optional_ptr<TableFilterSet> filters)
     : file_path(options_p.file_path), file_idx(0), buffer_manager(std::move(buffer_manager_p)),
       state_machine(std::move(state_machine_p)), file_size(buffer_manager->file_handle->FileSize()),
       error_handler(make_shared_ptr<CSVErrorHandler>(options_p.ignore_errors.GetValue())),
@@ -18,7 +19,7 @@ CSVFileScan::CSVFileScan(ClientContext &context, shared_ptr<CSVBufferManager> bu
 		options = union_reader.options;
 		types = union_reader.GetTypes();
 		MultiFileReader::InitializeReader(*this, options.file_options, bind_data.reader_bind, bind_data.return_types,
-		                                  bind_data.return_names, column_ids, nullptr, file_path, context);
+		                                  bind_data.return_names, column_ids, filters, file_path, context);
 		InitializeFileNamesTypes();
 		return;
 	} else if (!bind_data.column_info.empty()) {
@@ -26,7 +27,7 @@ CSVFileScan::CSVFileScan(ClientContext &context, shared_ptr<CSVBufferManager> bu
 		names = bind_data.column_info[0].names;
 		types = bind_data.column_info[0].types;
 		MultiFileReader::InitializeReader(*this, options.file_options, bind_data.reader_bind, bind_data.return_types,
-		                                  bind_data.return_names, column_ids, nullptr, file_path, context);
+		                                  bind_data.return_names, column_ids, filters, file_path, context);
 		InitializeFileNamesTypes();
 		return;
 	}
@@ -34,14 +35,14 @@ CSVFileScan::CSVFileScan(ClientContext &context, shared_ptr<CSVBufferManager> bu
 	types = bind_data.return_types;
 	file_schema = bind_data.return_types;
 	MultiFileReader::InitializeReader(*this, options.file_options, bind_data.reader_bind, bind_data.return_types,
-	                                  bind_data.return_names, column_ids, nullptr, file_path, context);
+	                                  bind_data.return_names, column_ids, filters, file_path, context);
 
 	InitializeFileNamesTypes();
 }
 
 CSVFileScan::CSVFileScan(ClientContext &context, const string &file_path_p, const CSVReaderOptions &options_p,
                          const idx_t file_idx_p, const ReadCSVData &bind_data, const vector<column_t> &column_ids,
-                         const vector<LogicalType> &file_schema)
+                         const vector<LogicalType> &file_schema, optional_ptr<TableFilterSet> filters)
     : file_path(file_path_p), file_idx(file_idx_p),
       error_handler(make_shared_ptr<CSVErrorHandler>(options_p.ignore_errors.GetValue())), options(options_p) {
 	if (file_idx < bind_data.union_readers.size()) {
@@ -64,7 +65,7 @@ CSVFileScan::CSVFileScan(ClientContext &context, const string &file_path_p, cons
 			types = union_reader.GetTypes();
 			state_machine = union_reader.state_machine;
 			MultiFileReader::InitializeReader(*this, options.file_options, bind_data.reader_bind,
-			                                  bind_data.return_types, bind_data.return_names, column_ids, nullptr,
+			                                  bind_data.return_types, bind_data.return_names, column_ids, filters,
 			                                  file_path, context);
 
 			InitializeFileNamesTypes();
@@ -86,22 +87,20 @@ CSVFileScan::CSVFileScan(ClientContext &context, const string &file_path_p, cons
 		types = bind_data.column_info[file_idx].types;
 		options.dialect_options.num_cols = names.size();
 		if (options.auto_detect) {
-			CSVSniffer sniffer(options, buffer_manager, state_machine_cache);
-			sniffer.SniffCSV();
+			CSVSnifferCache::SniffCSV(context, options, buffer_manager);
 		}
 		state_machine = make_shared_ptr<CSVStateMachine>(
 		    state_machine_cache.Get(options.dialect_options.state_machine_options), options);
 
 		MultiFileReader::InitializeReader(*this, options.file_options, bind_data.reader_bind, bind_data.return_types,
-		                                  bind_data.return_names, column_ids, nullptr, file_path, context);
+		                                  bind_data.return_names, column_ids, filters, file_path, context);
 		InitializeFileNamesTypes();
 		return;
 	}
 	// Sniff it (We only really care about dialect detection, if types or number of columns are different this will
 	// error out during scanning)
 	if (options.auto_detect && file_idx > 0) {
-		CSVSniffer sniffer(options, buffer_manager, state_machine_cache);
-		auto result = sniffer.SniffCSV();
+		auto result = CSVSnifferCache::SniffCSV(context, options, buffer_manager);
 		if (!file_schema.empty()) {
 			if (!options.file_options.filename && !options.file_options.hive_partitioning &&
 			    file_schema.size() != result.return_types.size()) {
@@ -124,7 +123,7 @@ CSVFileScan::CSVFileScan(ClientContext &context, const string &file_path_p, cons
 	    state_machine_cache.Get(options.dialect_options.state_machine_options), options);
 
 	MultiFileReader::InitializeReader(*this, options.file_options, bind_data.reader_bind, bind_data.return_types,
-	                                  bind_data.return_names, column_ids, nullptr, file_path, context);
+	                                  bind_data.return_names, column_ids, filters, file_path, context);
 	InitializeFileNamesTypes();
 }
 
@@ -139,8 +138,7 @@ CSVFileScan::CSVFileScan(ClientContext &context, const string &file_name, CSVRea
 	// error out during scanning)
 	auto &state_machine_cache = CSVStateMachineCache::Get(context);
 	if (options.auto_detect && options.dialect_options.num_cols == 0) {
-		CSVSniffer sniffer(options, buffer_manager, state_machine_cache);
-		auto sniffer_result = sniffer.SniffCSV();
+		auto sniffer_result = CSVSnifferCache::SniffCSV(context, options, buffer_manager);
 		if (names.empty()) {
 			names = sniffer_result.names;
 			types = sniffer_result.return_types;
@@ -192,6 +190,24 @@ void CSVFileScan::InitializeFileNamesTypes() {
 	file_types = sorted_types;
 }
 
+idx_t CSVFileScan::GetResultIndex(idx_t col_idx) const {
+	if (!projection_ids.empty()) {
+		return reader_data.column_mapping[projection_ids[col_idx].second];
+	}
+	return reader_data.column_mapping[col_idx];
+}
+
+optional_ptr<TableFilter> CSVFileScan::GetColumnFilter(idx_t col_idx) const {
+	if (!reader_data.filters || col_idx >= reader_data.column_ids.size()) {
+		return nullptr;
+	}
+	auto entry = reader_data.filters->filters.find(GetResultIndex(col_idx));
+	if (entry == reader_data.filters->filters.end()) {
+		return nullptr;
+	}
+	return entry->second.get();
+}
+
 const string &CSVFileScan::GetFileName() {
 	return file_path;
 }
@@ -9,8 +9,9 @@ namespace duckdb {
 
 CSVGlobalState::CSVGlobalState(ClientContext &context_p, const shared_ptr<CSVBufferManager> &buffer_manager,
                                const CSVReaderOptions &options, idx_t system_threads_p, const vector<string> &files,
-                               vector<column_t> column_ids_p, const ReadCSVData &bind_data_p)
-    : context(context_p), system_threads(system_threads_p), column_ids(std::move(column_ids_p)),
+                               vector<column_t> column_ids_p, const ReadCSVData &bind_data_p,
+                               optional_ptr<TableFilterSet> filters_p)
+    : context(context_p), system_threads(system_threads_p), column_ids(std::move(column_ids_p)), filters(filters_p),
       sniffer_mismatch_error(options.sniffer_user_mismatch_error), bind_data(bind_data_p) {
 
 	if (buffer_manager && buffer_manager->GetFilePath() == files[0]) {
@@ -18,11 +19,11 @@ CSVGlobalState::CSVGlobalState(ClientContext &context_p, const shared_ptr<CSVBuf
 		    CSVStateMachineCache::Get(context).Get(options.dialect_options.state_machine_options), options);
 		// If we already have a buffer manager, we don't need to reconstruct it to the first file
 		file_scans.emplace_back(make_uniq<CSVFileScan>(context, buffer_manager, state_machine, options, bind_data,
-		                                               column_ids, file_schema));
+		                                               column_ids, file_schema, filters));
 	} else {
 		// If not we need to construct it for the first file
 		file_scans.emplace_back(
-		    make_uniq<CSVFileScan>(context, files[0], options, 0U, bind_data, column_ids, file_schema));
+		    make_uniq<CSVFileScan>(context, files[0], options, 0U, bind_data, column_ids, file_schema, filters));
 	};
 	// There are situations where we only support single threaded scanning
 	bool many_csv_files = files.size() > 1 && files.size() > system_threads * 2;
@@ -68,7 +69,7 @@ unique_ptr<StringValueScanner> CSVGlobalState::Next(optional_ptr<StringValueScan
 		} else {
 			lock_guard<mutex> parallel_lock(main_mutex);
 			file_scans.emplace_back(make_shared_ptr<CSVFileScan>(context, bind_data.files[cur_idx], bind_data.options,
-			                                                     cur_idx, bind_data, column_ids, file_schema));
+			                                                     cur_idx, bind_data, column_ids, file_schema, filters));
 			current_file = file_scans.back();
 		}
 		if (previous_scanner) {
@@ -113,7 +114,7 @@ unique_ptr<StringValueScanner> CSVGlobalState::Next(optional_ptr<StringValueScan
 			// If we have a next file we have to construct the file scan for that
 			file_scans.emplace_back(make_shared_ptr<CSVFileScan>(context, bind_data.files[current_file_idx],
 			                                                     bind_data.options, current_file_idx, bind_data,
-			                                                     column_ids, file_schema));
+			                                                     column_ids, file_schema, filters));
 			// And re-start the boundary-iterator
 			auto buffer_size = file_scans.back()->buffer_manager->GetBuffer(0)->actual_size;
 			current_boundary = CSVIterator(current_file_idx, 0, 0, 0, buffer_size);
@@ -0,0 +1,406 @@
+#include "duckdb/execution/operator/order/physical_partitioned_top_n.hpp"
+
+#include "duckdb/common/sort/sort.hpp"
+#include "duckdb/common/types/row/row_layout.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/planner/expression/bound_window_expression.hpp"
+
+namespace duckdb {
+
+PhysicalPartitionedTopN::PhysicalPartitionedTopN(vector<LogicalType> types, unique_ptr<Expression> window_expr_p,
+                                                 idx_t limit, idx_t estimated_cardinality)
+    : PhysicalOperator(PhysicalOperatorType::PARTITIONED_TOP_N, std::move(types), estimated_cardinality),
+      window_expr(std::move(window_expr_p)), limit(limit) {
+	auto &wexpr = window_expr->Cast<BoundWindowExpression>();
+	D_ASSERT(wexpr.type == ExpressionType::WINDOW_ROW_NUMBER);
+	partition_count = wexpr.partitions.size();
+	for (auto &partition : wexpr.partitions) {
+		// the partitions only need to be grouped together - any order will do
+		orders.emplace_back(OrderType::ASCENDING, OrderByNullType::NULLS_FIRST, partition->Copy());
+	}
+	for (auto &order : wexpr.orders) {
+		orders.push_back(order.Copy());
+	}
+	payload_types = this->types;
+	payload_types.pop_back();
+}
+
+bool PhysicalPartitionedTopN::GetRowNumberLimit(ExpressionType comparison, const Value &constant, idx_t &limit) {
+	Value bound_value;
+	if (constant.IsNull() || !constant.type().IsIntegral() ||
+	    !constant.DefaultTryCastAs(LogicalType::BIGINT, bound_value, nullptr)) {
+		return false;
+	}
+	auto bound = bound_value.GetValue<int64_t>();
+	switch (comparison) {
+	case ExpressionType::COMPARE_LESSTHAN:
+		bound--;
+		break;
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+	case ExpressionType::COMPARE_EQUAL:
+		break;
+	default:
+		return false;
+	}
+	limit = bound < 0 ? 0 : UnsafeNumericCast<idx_t>(bound);
+	return true;
+}
+
+//===--------------------------------------------------------------------===//
+// Heap
+//===--------------------------------------------------------------------===//
+struct PartitionedTopNScanState {
+	unique_ptr<PayloadScanner> scanner;
+	//! The partition values of the last scanned row
+	DataChunk last_partition;
+	//! The row number of the last scanned row
+	idx_t row_number = 0;
+};
+
+//! PartitionedTopNHeap collects rows in a sort, which is reduced to the first "limit" rows of each partition whenever
+//! it grows to twice the size it had after the previous reduction
+class PartitionedTopNHeap {
+public:
+	PartitionedTopNHeap(ClientContext &context, const PhysicalPartitionedTopN &op);
+
+	void Sink(DataChunk &input);
+	//! Appends the first "limit" rows of each partition of another heap, which must have been finalized
+	void Combine(PartitionedTopNHeap &other);
+	void Reduce();
+	void Finalize();
+
+	void InitializeScan(PartitionedTopNScanState &state);
+	//! Scans the next rows that are among the first "limit" rows of their partition into the payload chunk,
+	//! and their row numbers into the row_numbers vector
+	void Scan(PartitionedTopNScanState &state, DataChunk &payload, Vector &row_numbers);
+
+	//! The minimum number of collected rows before we reduce
+	static constexpr const idx_t MIN_REDUCE_THRESHOLD = STANDARD_VECTOR_SIZE * 50ULL;
+
+private:
+	void InitializeSort();
+	void InitializeScan(GlobalSortState &sorted_state, PartitionedTopNScanState &state);
+	void Append(DataChunk &input);
+
+	ClientContext &context;
+	BufferManager &buffer_manager;
+	const PhysicalPartitionedTopN &op;
+
+	unique_ptr<GlobalSortState> global_state;
+	unique_ptr<LocalSortState> local_state;
+	//! The number of rows in the sort
+	idx_t count;
+	//! The number of rows at which we reduce next
+	idx_t reduce_threshold;
+	bool is_sorted;
+
+	ExpressionExecutor executor;
+	DataChunk sort_chunk;
+	ExpressionExecutor partition_executor;
+	DataChunk partition_chunk;
+	DataChunk compare_chunk;
+	SelectionVector distinct_sel;
+	SelectionVector result_sel;
+};
+
+PartitionedTopNHeap::PartitionedTopNHeap(ClientContext &context, const PhysicalPartitionedTopN &op)
+    : context(context), buffer_manager(BufferManager::GetBufferManager(context)), op(op), count(0),
+      reduce_threshold(MIN_REDUCE_THRESHOLD), is_sorted(false), executor(context), partition_executor(context),
+      distinct_sel(STANDARD_VECTOR_SIZE), result_sel(STANDARD_VECTOR_SIZE) {
+	auto &allocator = Allocator::Get(context);
+	vector<LogicalType> sort_types;
+	vector<LogicalType> partition_types;
+	for (idx_t i = 0; i < op.orders.size(); i++) {
+		auto &expr = *op.orders[i].expression;
+		sort_types.push_back(expr.return_type);
+		executor.AddExpression(expr);
+		if (i < op.partition_count) {
+			partition_types.push_back(expr.return_type);
+			partition_executor.AddExpression(expr);
+		}
+	}
+	sort_chunk.Initialize(allocator, sort_types);
+	if (!partition_types.empty()) {
+		partition_chunk.Initialize(allocator, partition_types);
+		compare_chunk.Initialize(allocator, partition_types);
+	}
+	InitializeSort();
+}
+
+void PartitionedTopNHeap::InitializeSort() {
+	RowLayout layout;
+	layout.Initialize(op.payload_types);
+	global_state = make_uniq<GlobalSortState>(buffer_manager, op.orders, layout);
+	local_state = make_uniq<LocalSortState>();
+	local_state->Initialize(*global_state, buffer_manager);
+	count = 0;
+	is_sorted = false;
+}
+
+void PartitionedTopNHeap::Append(DataChunk &input) {
+	D_ASSERT(!is_sorted);
+	sort_chunk.Reset();
+	executor.Execute(input, sort_chunk);
+	local_state->SinkChunk(sort_chunk, input);
+	count += input.size();
+}
+
+void PartitionedTopNHeap::Sink(DataChunk &input) {
+	Append(input);
+	if (count >= reduce_threshold) {
+		Reduce();
+	}
+}
+
+void PartitionedTopNHeap::Finalize() {
+	D_ASSERT(!is_sorted);
+	global_state->AddLocalState(*local_state);
+
+	global_state->PrepareMergePhase();
+	while (global_state->sorted_blocks.size() > 1) {
+		MergeSorter merge_sorter(*global_state, buffer_manager);
+		merge_sorter.PerformInMergeRound();
+		global_state->CompleteMergeRound();
+	}
+	is_sorted = true;
+}
+
+void PartitionedTopNHeap::Reduce() {
+	// sort what we have so far, and only keep the first rows of each partition
+	Finalize();
+	auto sorted_state = std::move(global_state);
+	auto sorted_local_state = std::move(local_state);
+	InitializeSort();
+
+	PartitionedTopNScanState state;
+	InitializeScan(*sorted_state, state);
+
+	DataChunk payload;
+	payload.Initialize(Allocator::Get(context), op.payload_types);
+	Vector row_numbers(LogicalType::BIGINT);
+	while (true) {
+		payload.Reset();
+		Scan(state, payload, row_numbers);
+		if (payload.size() == 0) {
+			break;
+		}
+		Append(payload);
+	}
+	// reduce again once we have doubled in size
+	reduce_threshold = MaxValue<idx_t>(MIN_REDUCE_THRESHOLD, 2 * count);
+}
+
+void PartitionedTopNHeap::Combine(PartitionedTopNHeap &other) {
+	// the other heap has been sorted already, so scanning it only yields the first rows of each of its partitions
+	D_ASSERT(other.is_sorted);
+	PartitionedTopNScanState state;
+	other.InitializeScan(state);
+	DataChunk payload;
+	payload.Initialize(Allocator::Get(context), op.payload_types);
+	Vector row_numbers(LogicalType::BIGINT);
+	while (true) {
+		payload.Reset();
+		other.Scan(state, payload, row_numbers);
+		if (payload.size() == 0) {
+			break;
+		}
+		// the combined rows are reduced already: they are not sorted again until the finalize
+		Append(payload);
+	}
+}
+
+void PartitionedTopNHeap::InitializeScan(PartitionedTopNScanState &state) {
+	D_ASSERT(is_sorted);
+	InitializeScan(*global_state, state);
+}
+
+void PartitionedTopNHeap::InitializeScan(GlobalSortState &sorted_state, PartitionedTopNScanState &state) {
+	if (sorted_state.sorted_blocks.empty()) {
+		state.scanner = nullptr;
+	} else {
+		D_ASSERT(sorted_state.sorted_blocks.size() == 1);
+		state.scanner = make_uniq<PayloadScanner>(*sorted_state.sorted_blocks[0]->payload_data, sorted_state);
+	}
+}
+
+void PartitionedTopNHeap::Scan(PartitionedTopNScanState &state, DataChunk &payload, Vector &row_numbers) {
+	if (!state.scanner) {
+		return;
+	}
+	auto limit = op.limit;
+	auto row_number_data = FlatVector::GetData<int64_t>(row_numbers);
+	while (payload.size() == 0) {
+		state.scanner->Scan(payload);
+		const auto scan_count = payload.size();
+		if (scan_count == 0) {
+			break;
+		}
+
+		// find the rows that start a new partition by comparing each row to the one before it
+		bool new_partitions[STANDARD_VECTOR_SIZE];
+		memset(new_partitions, 0, scan_count * sizeof(bool));
+		if (op.partition_count > 0) {
+			partition_chunk.Reset();
+			partition_executor.Execute(payload, partition_chunk);
+			if (state.last_partition.ColumnCount() == 0) {
+				// this is the first row we scan
+				state.last_partition.Initialize(Allocator::Get(context), partition_chunk.GetTypes());
+				new_partitions[0] = true;
+			}
+			compare_chunk.Reset();
+			for (idx_t col_idx = 0; col_idx < partition_chunk.ColumnCount(); col_idx++) {
+				auto &compare = compare_chunk.data[col_idx];
+				if (state.last_partition.size() > 0) {
+					VectorOperations::Copy(state.last_partition.data[col_idx], compare, 1, 0, 0);
+				} else {
+					VectorOperations::Copy(partition_chunk.data[col_idx], compare, 1, 0, 0);
+				}
+				VectorOperations::Copy(partition_chunk.data[col_idx], compare, scan_count - 1, 0, 1);
+				auto distinct_count = VectorOperations::DistinctFrom(partition_chunk.data[col_idx], compare, nullptr,
+				                                                     scan_count, &distinct_sel, nullptr);
+				for (idx_t i = 0; i < distinct_count; i++) {
+					new_partitions[distinct_sel.get_index(i)] = true;
+				}
+			}
+			// remember the partition of the last row for the next chunk
+			state.last_partition.Reset();
+			for (idx_t col_idx = 0; col_idx < partition_chunk.ColumnCount(); col_idx++) {
+				VectorOperations::Copy(partition_chunk.data[col_idx], state.last_partition.data[col_idx], scan_count,
+				                       scan_count - 1, 0);
+			}
+			state.last_partition.SetCardinality(1);
+		}
+
+		// number the rows, and only keep the ones within the limit
+		idx_t result_count = 0;
+		auto row_number = state.row_number;
+		for (idx_t i = 0; i < scan_count; i++) {
+			row_number = new_partitions[i] ? 1 : row_number + 1;
+			if (row_number <= limit) {
+				row_number_data[result_count] = UnsafeNumericCast<int64_t>(row_number);
+				result_sel.set_index(result_count++, i);
+			}
+		}
+		state.row_number = row_number;
+		if (result_count == 0) {
+			payload.Reset();
+		} else if (result_count < scan_count) {
+			payload.Slice(result_sel, result_count);
+		}
+	}
+}
+
+class PartitionedTopNGlobalState : public GlobalSinkState {
+public:
+	PartitionedTopNGlobalState(ClientContext &context, const PhysicalPartitionedTopN &op) : heap(context, op) {
+	}
+
+	mutex lock;
+	PartitionedTopNHeap heap;
+};
+
+class PartitionedTopNLocalState : public LocalSinkState {
+public:
+	PartitionedTopNLocalState(ClientContext &context, const PhysicalPartitionedTopN &op) : heap(context, op) {
+	}
+
+	PartitionedTopNHeap heap;
+};
+
+unique_ptr<LocalSinkState> PhysicalPartitionedTopN::GetLocalSinkState(ExecutionContext &context) const {
+	return make_uniq<PartitionedTopNLocalState>(context.client, *this);
+}
+
+unique_ptr<GlobalSinkState> PhysicalPartitionedTopN::GetGlobalSinkState(ClientContext &context) const {
+	return make_uniq<PartitionedTopNGlobalState>(context, *this);
+}
+
+//===--------------------------------------------------------------------===//
+// Sink
+//===--------------------------------------------------------------------===//
+SinkResultType PhysicalPartitionedTopN::Sink(ExecutionContext &context, DataChunk &chunk,
+                                             OperatorSinkInput &input) const {
+	auto &sink = input.local_state.Cast<PartitionedTopNLocalState>();
+	sink.heap.Sink(chunk);
+	return SinkResultType::NEED_MORE_INPUT;
+}
+
+//===--------------------------------------------------------------------===//
+// Combine
+//===--------------------------------------------------------------------===//
+SinkCombineResultType PhysicalPartitionedTopN::Combine(ExecutionContext &context,
+                                                       OperatorSinkCombineInput &input) const {
+	auto &gstate = input.global_state.Cast<PartitionedTopNGlobalState>();
+	auto &lstate = input.local_state.Cast<PartitionedTopNLocalState>();
+
+	// sort the local rows before taking the lock, then append the first rows of each local partition to the global heap
+	lstate.heap.Finalize();
+	lock_guard<mutex> glock(gstate.lock);
+	gstate.heap.Combine(lstate.heap);
+
+	return SinkCombineResultType::FINISHED;
+}
+
+//===--------------------------------------------------------------------===//
+// Finalize
+//===--------------------------------------------------------------------===//
+SinkFinalizeType PhysicalPartitionedTopN::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+                                                   OperatorSinkFinalizeInput &input) const {
+	auto &gstate = input.global_state.Cast<PartitionedTopNGlobalState>();
+	gstate.heap.Finalize();
+	return SinkFinalizeType::READY;
+}
+
+//===--------------------------------------------------------------------===//
+// Source
+//===--------------------------------------------------------------------===//
+class PartitionedTopNSourceState : public GlobalSourceState {
+public:
+	PartitionedTopNSourceState(ClientContext &context, const PhysicalPartitionedTopN &op) {
+		payload.Initialize(Allocator::Get(context), op.payload_types);
+	}
+
+	PartitionedTopNScanState state;
+	bool initialized = false;
+	DataChunk payload;
+};
+
+unique_ptr<GlobalSourceState> PhysicalPartitionedTopN::GetGlobalSourceState(ClientContext &context) const {
+	return make_uniq<PartitionedTopNSourceState>(context, *this);
+}
+
+SourceResultType PhysicalPartitionedTopN::GetData(ExecutionContext &context, DataChunk &chunk,
+                                                  OperatorSourceInput &input) const {
+	if (limit == 0) {
+		return SourceResultType::FINISHED;
+	}
+	auto &state = input.global_state.Cast<PartitionedTopNSourceState>();
+	auto &gstate = sink_state->Cast<PartitionedTopNGlobalState>();
+
+	if (!state.initialized) {
+		gstate.heap.InitializeScan(state.state);
+		state.initialized = true;
+	}
+
+	// the payload columns are followed by the row number
+	auto &payload = state.payload;
+	payload.Reset();
+	gstate.heap.Scan(state.state, payload, chunk.data.back());
+	for (idx_t col_idx = 0; col_idx < payload_types.size(); col_idx++) {
+		chunk.data[col_idx].Reference(payload.data[col_idx]);
+	}
+	chunk.SetCardinality(payload.size());
+
+	return chunk.size() == 0 ? SourceResultType::FINISHED : SourceResultType::HAVE_MORE_OUTPUT;
+}
+
+string PhysicalPartitionedTopN::ParamsToString() const {
+	string result;
+	result += "Top " + to_string(limit) + " per partition";
+	result += "\n[INFOSEPARATOR]\n";
+	result += window_expr->ToString();
+	return result;
+}
+
+} // namespace duckdb
@@ -75,6 +75,8 @@ public:
 	DataChunk boundary_values;
 	//! Whether or not the boundary_values has been set. The boundary_values are only set after a reduce step
 	bool has_boundary_values;
+	//! The filter in the scan that is tightened whenever the boundary values change (if any)
+	shared_ptr<DynamicFilterData> dynamic_filter;
 
 	SelectionVector final_sel;
 	SelectionVector true_sel;
@@ -326,6 +328,10 @@ void TopNHeap::ExtractBoundaryValues(DataChunk &current_chunk, DataChunk &prev_c
 		boundary_values.data[i].SetVectorType(VectorType::CONSTANT_VECTOR);
 	}
 	has_boundary_values = true;
+	if (dynamic_filter) {
+		// rows past the boundary of the first order can be skipped by the scan
+		dynamic_filter->Tighten(boundary_values.GetValue(0, 0));
+	}
 }
 
 bool TopNHeap::CheckBoundaryValues(DataChunk &sort_chunk, DataChunk &payload) {
@@ -400,9 +406,9 @@ void TopNHeap::Scan(TopNScanState &state, DataChunk &chunk) {
 
 class TopNGlobalState : public GlobalSinkState {
 public:
-	TopNGlobalState(ClientContext &context, const vector<LogicalType> &payload_types,
-	                const vector<BoundOrderByNode> &orders, idx_t limit, idx_t offset)
-	    : heap(context, payload_types, orders, limit, offset) {
+	TopNGlobalState(ClientContext &context, const PhysicalTopN &op)
+	    : heap(context, op.types, op.orders, op.limit, op.offset) {
+		heap.dynamic_filter = op.dynamic_filter;
 	}
 
 	mutex lock;
@@ -411,20 +417,24 @@ public:
 
 class TopNLocalState : public LocalSinkState {
 public:
-	TopNLocalState(ExecutionContext &context, const vector<LogicalType> &payload_types,
-	               const vector<BoundOrderByNode> &orders, idx_t limit, idx_t offset)
-	    : heap(context, payload_types, orders, limit, offset) {
+	TopNLocalState(ExecutionContext &context, const PhysicalTopN &op)
+	    : heap(context, op.types, op.orders, op.limit, op.offset) {
+		heap.dynamic_filter = op.dynamic_filter;
 	}
 
 	TopNHeap heap;
 };
 
 unique_ptr<LocalSinkState> PhysicalTopN::GetLocalSinkState(ExecutionContext &context) const {
-	return make_uniq<TopNLocalState>(context, types, orders, limit, offset);
+	return make_uniq<TopNLocalState>(context, *this);
 }
 
 unique_ptr<GlobalSinkState> PhysicalTopN::GetGlobalSinkState(ClientContext &context) const {
-	return make_uniq<TopNGlobalState>(context, types, orders, limit, offset);
+	if (dynamic_filter) {
+		// the boundary of a previous execution does not hold for this one
+		dynamic_filter->Reset();
+	}
+	return make_uniq<TopNGlobalState>(context, *this);
 }
 
 //===--------------------------------------------------------------------===//
@@ -6,6 +6,7 @@
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/storage/table/scan_state.hpp"
 #include "duckdb/transaction/duck_transaction.hpp"
+#include "duckdb/transaction/local_storage.hpp"
 #include "duckdb/storage/table/delete_state.hpp"
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 
@@ -23,13 +24,19 @@ PhysicalDelete::PhysicalDelete(vector<LogicalType> types, TableCatalogEntry &tab
 //===--------------------------------------------------------------------===//
 class DeleteGlobalState : public GlobalSinkState {
 public:
-	explicit DeleteGlobalState(ClientContext &context, const vector<LogicalType> &return_types)
+	explicit DeleteGlobalState(ClientContext &context, const vector<LogicalType> &return_types, DataTable &table)
 	    : deleted_count(0), return_collection(context, return_types) {
+		has_local_storage = LocalStorage::Get(context, table.db).Find(table);
 	}
 
 	mutex delete_lock;
-	idx_t deleted_count;
+	atomic<idx_t> deleted_count;
+	mutex return_lock;
 	ColumnDataCollection return_collection;
+	//! Whether or not the transaction has local storage for the table
+	//! deletes from the transaction-local storage are not thread-safe, so in this case we serialize all deletes
+	//! otherwise, deletes are applied in parallel and only synchronize on the (per row group) version info
+	bool has_local_storage;
 };
 
 class DeleteLocalState : public LocalSinkState {
@@ -57,11 +64,15 @@ SinkResultType PhysicalDelete::Sink(ExecutionContext &context, DataChunk &chunk,
 	};
 	auto cfs = ColumnFetchState();
 
-	lock_guard<mutex> delete_guard(gstate.delete_lock);
+	unique_lock<mutex> delete_guard(gstate.delete_lock, std::defer_lock);
+	if (gstate.has_local_storage) {
+		delete_guard.lock();
+	}
 	if (return_chunk) {
 		ustate.delete_chunk.Reset();
 		row_identifiers.Flatten(chunk.size());
 		table.Fetch(transaction, ustate.delete_chunk, column_ids, row_identifiers, chunk.size(), cfs);
+		lock_guard<mutex> return_guard(gstate.return_lock);
 		gstate.return_collection.Append(ustate.delete_chunk);
 	}
 	gstate.deleted_count += table.Delete(*ustate.delete_state, context.client, row_identifiers, chunk.size());
@@ -69,7 +80,7 @@ SinkResultType PhysicalDelete::Sink(ExecutionContext &context, DataChunk &chunk,
 }
 
 unique_ptr<GlobalSinkState> PhysicalDelete::GetGlobalSinkState(ClientContext &context) const {
-	return make_uniq<DeleteGlobalState>(context, GetTypes());
+	return make_uniq<DeleteGlobalState>(context, GetTypes(), table);
 }
 
 unique_ptr<LocalSinkState> PhysicalDelete::GetLocalSinkState(ExecutionContext &context) const {
@@ -102,7 +113,7 @@ SourceResultType PhysicalDelete::GetData(ExecutionContext &context, DataChunk &c
 	auto &g = sink_state->Cast<DeleteGlobalState>();
 	if (!return_chunk) {
 		chunk.SetCardinality(1);
-		chunk.SetValue(0, 0, Value::BIGINT(NumericCast<int64_t>(g.deleted_count)));
+		chunk.SetValue(0, 0, Value::BIGINT(NumericCast<int64_t>(g.deleted_count.load())));
 		return SourceResultType::FINISHED;
 	}
 
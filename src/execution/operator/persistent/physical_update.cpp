@@ -10,6 +10,7 @@
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/storage/table/delete_state.hpp"
 #include "duckdb/storage/table/update_state.hpp"
+#include "duckdb/transaction/local_storage.hpp"
 
 namespace duckdb {
 
@@ -29,14 +30,20 @@ PhysicalUpdate::PhysicalUpdate(vector<LogicalType> types, TableCatalogEntry &tab
 //===--------------------------------------------------------------------===//
 class UpdateGlobalState : public GlobalSinkState {
 public:
-	explicit UpdateGlobalState(ClientContext &context, const vector<LogicalType> &return_types)
+	explicit UpdateGlobalState(ClientContext &context, const vector<LogicalType> &return_types, DataTable &table)
 	    : updated_count(0), return_collection(context, return_types) {
+		has_local_storage = LocalStorage::Get(context, table.db).Find(table);
 	}
 
 	mutex lock;
-	idx_t updated_count;
+	atomic<idx_t> updated_count;
 	unordered_set<row_t> updated_columns;
+	mutex return_lock;
 	ColumnDataCollection return_collection;
+	//! Whether or not the transaction has local storage for the table
+	//! in-place updates of the base table are applied in parallel (synchronizing on the updated column segments)
+	//! updates of transaction-local storage and delete + insert updates are serialized
+	bool has_local_storage;
 };
 
 class UpdateLocalState : public LocalSinkState {
@@ -107,7 +114,10 @@ SinkResultType PhysicalUpdate::Sink(ExecutionContext &context, DataChunk &chunk,
 		}
 	}
 
-	lock_guard<mutex> glock(gstate.lock);
+	unique_lock<mutex> glock(gstate.lock, std::defer_lock);
+	if (update_is_del_and_insert || gstate.has_local_storage) {
+		glock.lock();
+	}
 	if (update_is_del_and_insert) {
 		// index update or update on complex type, perform a delete and an append instead
 
@@ -148,6 +158,7 @@ SinkResultType PhysicalUpdate::Sink(ExecutionContext &context, DataChunk &chunk,
 	}
 
 	if (return_chunk) {
+		lock_guard<mutex> return_guard(gstate.return_lock);
 		gstate.return_collection.Append(mock_chunk);
 	}
 
@@ -157,7 +168,7 @@ SinkResultType PhysicalUpdate::Sink(ExecutionContext &context, DataChunk &chunk,
 }
 
 unique_ptr<GlobalSinkState> PhysicalUpdate::GetGlobalSinkState(ClientContext &context) const {
-	return make_uniq<UpdateGlobalState>(context, GetTypes());
+	return make_uniq<UpdateGlobalState>(context, GetTypes(), table);
 }
 
 unique_ptr<LocalSinkState> PhysicalUpdate::GetLocalSinkState(ExecutionContext &context) const {
@@ -200,7 +211,7 @@ SourceResultType PhysicalUpdate::GetData(ExecutionContext &context, DataChunk &c
 	auto &g = sink_state->Cast<UpdateGlobalState>();
 	if (!return_chunk) {
 		chunk.SetCardinality(1);
-		chunk.SetValue(0, 0, Value::BIGINT(NumericCast<int64_t>(g.updated_count)));
+		chunk.SetValue(0, 0, Value::BIGINT(NumericCast<int64_t>(g.updated_count.load())));
 		return SourceResultType::FINISHED;
 	}
 
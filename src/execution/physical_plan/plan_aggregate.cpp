@@ -1,6 +1,9 @@
 #include "duckdb/catalog/catalog_entry/aggregate_function_catalog_entry.hpp"
+#include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
 #include "duckdb/common/operator/subtract.hpp"
+#include "duckdb/common/string_util.hpp"
 #include "duckdb/execution/operator/aggregate/physical_hash_aggregate.hpp"
+#include "duckdb/execution/operator/aggregate/physical_ordered_aggregate.hpp"
 #include "duckdb/execution/operator/aggregate/physical_perfecthash_aggregate.hpp"
 #include "duckdb/execution/operator/aggregate/physical_ungrouped_aggregate.hpp"
 #include "duckdb/execution/operator/projection/physical_projection.hpp"
@@ -9,8 +12,14 @@
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/parser/expression/comparison_expression.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/planner/operator/logical_aggregate.hpp"
+#include "duckdb/planner/operator/logical_filter.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/operator/logical_order.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
+#include "duckdb/storage/data_table.hpp"
 
 namespace duckdb {
 
@@ -149,10 +158,151 @@ static bool CanUsePerfectHashAggregate(ClientContext &context, LogicalAggregate
 	return true;
 }
 
+enum class AggregateInputOrder : uint8_t {
+	//! the input is not known to be ordered on the groups
+	UNORDERED,
+	//! the input is probably ordered on the groups, but this has to be verified while aggregating
+	ORDERED_UNVERIFIED,
+	//! the input is guaranteed to be ordered on all groups
+	ORDERED
+};
+
+static AggregateInputOrder InputIsOrderedOn(LogicalOperator &input, vector<idx_t> column_indexes) {
+	// the column bindings have been resolved into references at this point: follow the columns by their index in the
+	// output of each operator, through projections and filters to the operator that produces them
+	// only the first column has to be followed, the other columns are set to INVALID_INDEX once they are lost
+	reference<LogicalOperator> current = input;
+	while (true) {
+		auto &op = current.get();
+		switch (op.type) {
+		case LogicalOperatorType::LOGICAL_PROJECTION: {
+			auto &projection = op.Cast<LogicalProjection>();
+			for (idx_t i = 0; i < column_indexes.size(); i++) {
+				if (column_indexes[i] == DConstants::INVALID_INDEX) {
+					continue;
+				}
+				reference<Expression> expr = *projection.expressions[column_indexes[i]];
+				if (expr.get().type == ExpressionType::BOUND_FUNCTION) {
+					// compressed materialization subtracts the minimum from integers, which preserves their order
+					auto &func_expr = expr.get().Cast<BoundFunctionExpression>();
+					if (StringUtil::StartsWith(func_expr.function.name, "__internal_compress_integral_")) {
+						expr = *func_expr.children[0];
+					}
+				}
+				if (expr.get().type != ExpressionType::BOUND_REF) {
+					if (i == 0) {
+						return AggregateInputOrder::UNORDERED;
+					}
+					column_indexes[i] = DConstants::INVALID_INDEX;
+					continue;
+				}
+				column_indexes[i] = expr.get().Cast<BoundReferenceExpression>().index;
+			}
+			current = *op.children[0];
+			break;
+		}
+		case LogicalOperatorType::LOGICAL_FILTER: {
+			auto &filter = op.Cast<LogicalFilter>();
+			if (!filter.projection_map.empty()) {
+				for (auto &column_index : column_indexes) {
+					if (column_index != DConstants::INVALID_INDEX) {
+						column_index = filter.projection_map[column_index];
+					}
+				}
+			}
+			current = *op.children[0];
+			break;
+		}
+		case LogicalOperatorType::LOGICAL_ORDER_BY: {
+			// the input is explicitly sorted: it is ordered on all groups if they are the leading orders
+			auto &order_by = op.Cast<LogicalOrder>();
+			idx_t ordered_count = 0;
+			for (idx_t i = 0; i < column_indexes.size() && i < order_by.orders.size(); i++) {
+				auto column_index = column_indexes[i];
+				if (column_index == DConstants::INVALID_INDEX) {
+					break;
+				}
+				if (!order_by.projections.empty()) {
+					column_index = order_by.projections[column_index];
+				}
+				auto &order = order_by.orders[i];
+				if (order.type != OrderType::ASCENDING || order.expression->type != ExpressionType::BOUND_REF ||
+				    order.expression->Cast<BoundReferenceExpression>().index != column_index) {
+					break;
+				}
+				ordered_count++;
+			}
+			if (ordered_count == 0) {
+				return AggregateInputOrder::UNORDERED;
+			}
+			return ordered_count == column_indexes.size() ? AggregateInputOrder::ORDERED
+			                                              : AggregateInputOrder::ORDERED_UNVERIFIED;
+		}
+		case LogicalOperatorType::LOGICAL_GET: {
+			// the columns are read from a table: check if the statistics show that the table is ordered on the first
+			// the statistics only show that the row groups are ordered, not the rows within them (or the rows that are
+			// appended by the current transaction): this has to be verified while aggregating
+			auto &get = op.Cast<LogicalGet>();
+			auto table = get.GetTable();
+			if (!table || !table->IsDuckTable() || !get.projected_input.empty()) {
+				return AggregateInputOrder::UNORDERED;
+			}
+			auto column_index = column_indexes[0];
+			if (!get.projection_ids.empty()) {
+				column_index = get.projection_ids[column_index];
+			}
+			if (column_index >= get.column_ids.size()) {
+				return AggregateInputOrder::UNORDERED;
+			}
+			auto column_id = get.column_ids[column_index];
+			if (!table->Cast<DuckTableEntry>().GetStorage().RowGroupsOrderedOn(column_id)) {
+				return AggregateInputOrder::UNORDERED;
+			}
+			return AggregateInputOrder::ORDERED_UNVERIFIED;
+		}
+		default:
+			return AggregateInputOrder::UNORDERED;
+		}
+	}
+}
+
+static AggregateInputOrder GetAggregateInputOrder(LogicalAggregate &op) {
+	if (op.groups.empty() || op.grouping_sets.size() > 1 || !op.grouping_functions.empty()) {
+		return AggregateInputOrder::UNORDERED;
+	}
+	for (auto &group : op.groups) {
+		if (group->return_type.IsNested()) {
+			return AggregateInputOrder::UNORDERED;
+		}
+	}
+	for (auto &expression : op.expressions) {
+		auto &aggregate = expression->Cast<BoundAggregateExpression>();
+		if (aggregate.IsDistinct() || !aggregate.function.combine) {
+			return AggregateInputOrder::UNORDERED;
+		}
+	}
+	// the input must at least be ordered on the first group, in which case the order of the other groups is verified
+	// while aggregating: it is only guaranteed if the input is ordered on all groups
+	vector<idx_t> column_indexes;
+	for (auto &group : op.groups) {
+		if (group->type != ExpressionType::BOUND_REF) {
+			if (column_indexes.empty()) {
+				return AggregateInputOrder::UNORDERED;
+			}
+			column_indexes.push_back(DConstants::INVALID_INDEX);
+			continue;
+		}
+		column_indexes.push_back(group->Cast<BoundReferenceExpression>().index);
+	}
+	return InputIsOrderedOn(*op.children[0], std::move(column_indexes));
+}
+
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalAggregate &op) {
 	unique_ptr<PhysicalOperator> groupby;
 	D_ASSERT(op.children.size() == 1);
 
+	// check if the input is ordered on the groups before the child is planned
+	auto input_order = GetAggregateInputOrder(op);
 	auto plan = CreatePlan(*op.children[0]);
 
 	plan = ExtractAggregateExpressions(std::move(plan), op.expressions, op.groups);
@@ -184,6 +334,11 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalAggregate
 			groupby = make_uniq_base<PhysicalOperator, PhysicalPerfectHashAggregate>(
 			    context, op.types, std::move(op.expressions), std::move(op.groups), std::move(op.group_stats),
 			    std::move(required_bits), op.estimated_cardinality);
+		} else if (input_order != AggregateInputOrder::UNORDERED && plan->AllSourcesSupportBatchIndex()) {
+			// the input is ordered on the groups: aggregate runs of equal groups instead of building a hash table
+			groupby = make_uniq_base<PhysicalOperator, PhysicalOrderedAggregate>(
+			    context, op.types, std::move(op.expressions), std::move(op.groups),
+			    input_order == AggregateInputOrder::ORDERED, op.estimated_cardinality);
 		} else {
 			groupby = make_uniq_base<PhysicalOperator, PhysicalHashAggregate>(
 			    context, op.types, std::move(op.expressions), std::move(op.groups), std::move(op.grouping_sets),
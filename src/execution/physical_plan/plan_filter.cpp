@@ -1,18 +1,71 @@
 #include "duckdb/execution/operator/filter/physical_filter.hpp"
+#include "duckdb/execution/operator/order/physical_partitioned_top_n.hpp"
 #include "duckdb/execution/operator/projection/physical_projection.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
 #include "duckdb/optimizer/matcher/expression_matcher.hpp"
 #include "duckdb/planner/expression/bound_comparison_expression.hpp"
 #include "duckdb/planner/expression/bound_constant_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/expression/bound_window_expression.hpp"
 #include "duckdb/planner/operator/logical_filter.hpp"
 #include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/operator/logical_window.hpp"
 
 namespace duckdb {
 
+//! Checks whether the filter only keeps the first rows of each partition of a single ROW_NUMBER window below it,
+//! e.g. QUALIFY row_number() OVER (PARTITION BY ... ORDER BY ...) <= k
+static bool IsPartitionedTopN(LogicalFilter &op, idx_t &limit) {
+	auto &child = *op.children[0];
+	if (child.type != LogicalOperatorType::LOGICAL_WINDOW || child.expressions.size() != 1) {
+		return false;
+	}
+	auto &wexpr = child.expressions[0]->Cast<BoundWindowExpression>();
+	if (wexpr.type != ExpressionType::WINDOW_ROW_NUMBER || wexpr.partitions.empty() || wexpr.filter_expr) {
+		return false;
+	}
+	// the row number is the last column of the window
+	const auto row_number_idx = child.types.size() - 1;
+	for (auto &expr : op.expressions) {
+		if (expr->GetExpressionClass() != ExpressionClass::BOUND_COMPARISON) {
+			continue;
+		}
+		auto &comparison = expr->Cast<BoundComparisonExpression>();
+		auto comparison_type = comparison.type;
+		auto column = comparison.left.get();
+		auto constant = comparison.right.get();
+		if (column->type == ExpressionType::VALUE_CONSTANT) {
+			std::swap(column, constant);
+			comparison_type = FlipComparisonExpression(comparison_type);
+		}
+		if (column->type != ExpressionType::BOUND_REF || constant->type != ExpressionType::VALUE_CONSTANT) {
+			continue;
+		}
+		if (column->Cast<BoundReferenceExpression>().index != row_number_idx) {
+			continue;
+		}
+		auto &value = constant->Cast<BoundConstantExpression>().value;
+		if (PhysicalPartitionedTopN::GetRowNumberLimit(comparison_type, value, limit)) {
+			return true;
+		}
+	}
+	return false;
+}
+
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalFilter &op) {
 	D_ASSERT(op.children.size() == 1);
-	unique_ptr<PhysicalOperator> plan = CreatePlan(*op.children[0]);
+	unique_ptr<PhysicalOperator> plan;
+	idx_t limit;
+	if (IsPartitionedTopN(op, limit)) {
+		// only compute the row numbers of the rows that can pass the filter
+		auto &window = op.children[0]->Cast<LogicalWindow>();
+		auto top_n = make_uniq<PhysicalPartitionedTopN>(window.types, std::move(window.expressions[0]), limit,
+		                                                window.EstimateCardinality(context));
+		top_n->children.push_back(CreatePlan(*window.children[0]));
+		plan = std::move(top_n);
+	} else {
+		plan = CreatePlan(*op.children[0]);
+	}
 	if (!op.expressions.empty()) {
 		D_ASSERT(plan->types.size() > 0);
 		// create a filter if there is anything to filter
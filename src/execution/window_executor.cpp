@@ -1044,6 +1044,11 @@ void WindowAggregateExecutor::Finalize() {
 	aggregator->Finalize(stats);
 }
 
+void WindowAggregateExecutor::Build() {
+	D_ASSERT(aggregator);
+	aggregator->Build();
+}
+
 class WindowAggregateState : public WindowExecutorBoundsState {
 public:
 	WindowAggregateState(BoundWindowExpression &wexpr, ClientContext &context, const idx_t payload_count,
@@ -6,6 +6,7 @@
 #include "duckdb/execution/merge_sort_tree.hpp"
 #include "duckdb/planner/expression/bound_constant_expression.hpp"
 #include "duckdb/execution/window_executor.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 
 #include <numeric>
 #include <utility>
@@ -599,7 +600,8 @@ void WindowNaiveAggregator::Evaluate(WindowAggregatorState &lstate, const DataCh
 //===--------------------------------------------------------------------===//
 WindowSegmentTree::WindowSegmentTree(AggregateObject aggr, const LogicalType &result_type, WindowAggregationMode mode_p,
                                      const WindowExcludeMode exclude_mode_p, idx_t count)
-    : WindowAggregator(std::move(aggr), result_type, exclude_mode_p, count), internal_nodes(0), mode(mode_p) {
+    : WindowAggregator(std::move(aggr), result_type, exclude_mode_p, count), internal_nodes(0), mode(mode_p),
+      build_level(0), build_started(0), build_completed(0) {
 }
 
 void WindowSegmentTree::Finalize(const FrameStats &stats) {
@@ -608,7 +610,7 @@ void WindowSegmentTree::Finalize(const FrameStats &stats) {
 	gstate = GetLocalState();
 	if (inputs.ColumnCount() > 0) {
 		if (aggr.function.combine && UseCombineAPI()) {
-			ConstructTree();
+			AllocateTree();
 		}
 	}
 }
@@ -837,46 +839,110 @@ void WindowSegmentTreePart::Finalize(Vector &result, idx_t count) {
 	}
 }
 
-void WindowSegmentTree::ConstructTree() {
+void WindowSegmentTree::AllocateTree() {
 	D_ASSERT(inputs.ColumnCount() > 0);
 
-	//	Use a temporary scan state to build the tree
-	auto &gtstate = gstate->Cast<WindowSegmentTreeState>().part;
-
 	// compute space required to store internal nodes of segment tree
+	// levels_flat_start[l] is the offset of the nodes that are built from level l
 	internal_nodes = 0;
-	idx_t level_nodes = inputs.size();
-	do {
-		level_nodes = (level_nodes + (TREE_FANOUT - 1)) / TREE_FANOUT;
-		internal_nodes += level_nodes;
-	} while (level_nodes > 1);
-	levels_flat_native = make_unsafe_uniq_array<data_t>(internal_nodes * state_size);
 	levels_flat_start.push_back(0);
+	for (idx_t level_size = inputs.size(); level_size > 1;) {
+		level_size = (level_size + (TREE_FANOUT - 1)) / TREE_FANOUT;
+		internal_nodes += level_size;
+		levels_flat_start.push_back(internal_nodes);
+	}
 
-	idx_t levels_flat_offset = 0;
-	idx_t level_current = 0;
-	// level 0 is data itself
-	idx_t level_size;
-	// iterate over the levels of the segment tree
-	while ((level_size =
-	            (level_current == 0 ? inputs.size() : levels_flat_offset - levels_flat_start[level_current - 1])) > 1) {
-		for (idx_t pos = 0; pos < level_size; pos += TREE_FANOUT) {
-			// compute the aggregate for this entry in the segment tree
-			data_ptr_t state_ptr = levels_flat_native.get() + (levels_flat_offset * state_size);
-			aggr.function.initialize(state_ptr);
-			gtstate.WindowSegmentValue(*this, level_current, pos, MinValue(level_size, pos + TREE_FANOUT), state_ptr);
-			gtstate.FlushStates(level_current > 0);
-
-			levels_flat_offset++;
+	// Corner case: single element in the window
+	internal_nodes = MaxValue<idx_t>(internal_nodes, 1);
+	levels_flat_native = make_unsafe_uniq_array<data_t>(internal_nodes * state_size);
+	for (idx_t i = 0; i < internal_nodes; ++i) {
+		aggr.function.initialize(levels_flat_native.get() + i * state_size);
+	}
+
+	//	The levels are built by the threads that evaluate the partition
+	build_level = 0;
+	build_started = 0;
+	build_completed = 0;
+}
+
+idx_t WindowSegmentTree::LevelSize(idx_t level_idx) const {
+	return level_idx ? levels_flat_start[level_idx] - levels_flat_start[level_idx - 1] : inputs.size();
+}
+
+bool WindowSegmentTree::TryNextTask(idx_t &level_idx, idx_t &begin, idx_t &end) {
+	lock_guard<mutex> build_guard(build_lock);
+
+	//	Finished with this level?
+	const auto levels = levels_flat_start.size() - 1;
+	if (build_level < levels) {
+		const auto level_nodes = levels_flat_start[build_level + 1] - levels_flat_start[build_level];
+		if (build_completed >= level_nodes) {
+			++build_level;
+			build_started = 0;
+			build_completed = 0;
 		}
+	}
 
-		levels_flat_start.push_back(levels_flat_offset);
-		level_current++;
+	if (build_level >= levels) {
+		return false;
 	}
 
-	// Corner case: single element in the window
-	if (levels_flat_offset == 0) {
-		aggr.function.initialize(levels_flat_native.get());
+	//	All the nodes of this level are claimed, but the level is not complete yet
+	const auto level_nodes = levels_flat_start[build_level + 1] - levels_flat_start[build_level];
+	if (build_started >= level_nodes) {
+		return false;
+	}
+
+	level_idx = build_level;
+	begin = build_started;
+	end = MinValue(begin + BUILD_TASK_NODES, level_nodes);
+	build_started = end;
+
+	return true;
+}
+
+void WindowSegmentTree::ConstructNodes(WindowAggregatorState &build_state, idx_t level_idx, idx_t begin, idx_t end) {
+	auto &part = build_state.Cast<WindowSegmentTreeState>().part;
+
+	// compute the aggregate for each node from the entries of the level below
+	const auto level_size = LevelSize(level_idx);
+	auto state_ptr = levels_flat_native.get() + (levels_flat_start[level_idx] + begin) * state_size;
+	for (auto node = begin; node < end; ++node, state_ptr += state_size) {
+		const auto pos = node * TREE_FANOUT;
+		part.WindowSegmentValue(*this, level_idx, pos, MinValue(level_size, pos + TREE_FANOUT), state_ptr);
+	}
+	part.FlushStates(level_idx > 0);
+
+	build_completed += end - begin;
+}
+
+void WindowSegmentTree::Build() {
+	if (levels_flat_start.empty()) {
+		return;
+	}
+
+	//	Claim nodes until the whole tree is built,
+	//	waiting for the other threads to finish a level before moving to the next one
+	unique_ptr<WindowAggregatorState> build_state;
+	const auto levels = levels_flat_start.size() - 1;
+	while (build_level < levels) {
+		idx_t level_idx;
+		idx_t begin;
+		idx_t end;
+		if (TryNextTask(level_idx, begin, end)) {
+			if (!build_state) {
+				build_state = GetLocalState();
+			}
+			ConstructNodes(*build_state, level_idx, begin, end);
+		} else {
+			TaskScheduler::YieldThread();
+		}
+	}
+
+	//	The internal nodes may reference memory from the build allocator
+	if (build_state) {
+		lock_guard<mutex> build_guard(build_lock);
+		build_states.emplace_back(std::move(build_state));
 	}
 }
 
@@ -9,6 +9,7 @@
 #include "duckdb/execution/operator/csv_scanner/global_csv_state.hpp"
 #include "duckdb/execution/operator/csv_scanner/csv_error.hpp"
 #include "duckdb/execution/operator/csv_scanner/csv_sniffer.hpp"
+#include "duckdb/execution/operator/csv_scanner/csv_sniffer_cache.hpp"
 #include "duckdb/execution/operator/persistent/csv_rejects_table.hpp"
 #include "duckdb/function/function_set.hpp"
 #include "duckdb/main/client_context.hpp"
@@ -20,6 +21,8 @@
 #include "duckdb/parser/expression/function_expression.hpp"
 #include "duckdb/parser/tableref/table_function_ref.hpp"
 #include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/storage/table/column_segment.hpp"
 #include "duckdb/execution/operator/csv_scanner/csv_file_scanner.hpp"
 #include "duckdb/execution/operator/csv_scanner/base_scanner.hpp"
 
@@ -89,9 +92,8 @@ static unique_ptr<FunctionData> ReadCSVBind(ClientContext &context, TableFunctio
 	if (options.auto_detect && !options.file_options.union_by_name) {
 		options.file_path = result->files[0];
 		result->buffer_manager = make_shared_ptr<CSVBufferManager>(context, options, result->files[0], 0);
-		CSVSniffer sniffer(options, result->buffer_manager, CSVStateMachineCache::Get(context),
-		                   {&return_types, &names});
-		auto sniffer_result = sniffer.SniffCSV();
+		auto sniffer_result =
+		    CSVSnifferCache::SniffCSV(context, options, result->buffer_manager, {&return_types, &names});
 		if (names.empty()) {
 			names = sniffer_result.names;
 			return_types = sniffer_result.return_types;
@@ -187,7 +189,8 @@ static unique_ptr<GlobalTableFunctionState> ReadCSVInitGlobal(ClientContext &con
 		return nullptr;
 	}
 	return make_uniq<CSVGlobalState>(context, bind_data.buffer_manager, bind_data.options,
-	                                 context.db->NumberOfThreads(), bind_data.files, input.column_ids, bind_data);
+	                                 context.db->NumberOfThreads(), bind_data.files, input.column_ids, bind_data,
+	                                 input.filters);
 }
 
 unique_ptr<LocalTableFunctionState> ReadCSVInitLocal(ExecutionContext &context, TableFunctionInitInput &input,
@@ -203,6 +206,32 @@ unique_ptr<LocalTableFunctionState> ReadCSVInitLocal(ExecutionContext &context,
 	return make_uniq<CSVLocalState>(std::move(csv_scanner));
 }
 
+//! Filters on columns that are constant within a file (e.g. hive partitions or the filename) can only be applied once
+//! the constants have been set; the other filters are applied by the scanner
+static void ApplyConstantFilters(const MultiFileReaderData &reader_data, DataChunk &chunk) {
+	if (!reader_data.filters) {
+		return;
+	}
+	SelectionVector sel;
+	sel.Initialize(nullptr);
+	idx_t approved_count = chunk.size();
+	for (auto &constant : reader_data.constant_map) {
+		auto entry = reader_data.filters->filters.find(constant.column_id);
+		if (entry == reader_data.filters->filters.end()) {
+			continue;
+		}
+		auto &vector = chunk.data[constant.column_id];
+		UnifiedVectorFormat vdata;
+		vector.ToUnifiedFormat(chunk.size(), vdata);
+		ColumnSegment::FilterSelection(sel, vector, vdata, *entry->second, chunk.size(), approved_count);
+	}
+	if (approved_count == 0) {
+		chunk.Reset();
+	} else if (approved_count < chunk.size()) {
+		chunk.Slice(sel, approved_count);
+	}
+}
+
 static void ReadCSVFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
 	auto &bind_data = data_p.bind_data->Cast<ReadCSVData>();
 	if (!data_p.global_state) {
@@ -217,9 +246,12 @@ static void ReadCSVFunction(ClientContext &context, TableFunctionInput &data_p,
 	}
 	do {
 		if (output.size() != 0) {
-			MultiFileReader::FinalizeChunk(bind_data.reader_bind,
-			                               csv_local_state.csv_reader->csv_file_scan->reader_data, output);
-			break;
+			auto &reader_data = csv_local_state.csv_reader->csv_file_scan->reader_data;
+			MultiFileReader::FinalizeChunk(bind_data.reader_bind, reader_data, output);
+			ApplyConstantFilters(reader_data, output);
+			if (output.size() != 0) {
+				break;
+			}
 		}
 		if (csv_local_state.csv_reader->FinishedIterator()) {
 			csv_local_state.csv_reader = csv_global_state.Next(csv_local_state.csv_reader.get());
@@ -336,6 +368,7 @@ TableFunction ReadCSVTableFunction::GetFunction() {
 	read_csv.get_batch_index = CSVReaderGetBatchIndex;
 	read_csv.cardinality = CSVReaderCardinality;
 	read_csv.projection_pushdown = true;
+	read_csv.filter_pushdown = true;
 	ReadCSVAddNamedParameters(read_csv);
 	return read_csv;
 }
@@ -133,4 +133,23 @@ struct CountZeros<uhugeint_t> {
 	}
 };
 
+//! Operations on the bytes of a 64-bit word at once ("SIMD within a register")
+struct SWAR {
+	//! Returns a word of which every byte is equal to the given byte
+	static constexpr uint64_t Broadcast(uint8_t byte) {
+		return UINT64_C(0x0101010101010101) * byte;
+	}
+
+	//! Returns a mask with the high bit set for the zero bytes of v. Bytes after the first zero byte might be flagged
+	//! spuriously, but the lowest flagged byte is always a zero byte.
+	static inline uint64_t ZeroByteMask(uint64_t v) {
+		return (v - UINT64_C(0x0101010101010101)) & ~(v)&UINT64_C(0x8080808080808080);
+	}
+
+	//! Returns the position of the lowest flagged byte of a (non-zero) mask, in a little-endian load of the word
+	static inline idx_t FirstFlaggedByte(uint64_t mask) {
+		return CountZeros<uint64_t>::Trailing(mask) / 8;
+	}
+};
+
 } // namespace duckdb
@@ -22,11 +22,13 @@ enum class PhysicalOperatorType : uint8_t {
 	STREAMING_LIMIT,
 	LIMIT_PERCENT,
 	TOP_N,
+	PARTITIONED_TOP_N,
 	WINDOW,
 	UNNEST,
 	UNGROUPED_AGGREGATE,
 	HASH_GROUP_BY,
 	PERFECT_HASH_GROUP_BY,
+	ORDERED_GROUP_BY,
 	FILTER,
 	PROJECTION,
 	COPY_TO_FILE,
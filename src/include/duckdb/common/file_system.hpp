@@ -72,6 +72,7 @@ public:
 	DUCKDB_API bool CanSeek();
 	DUCKDB_API bool IsPipe();
 	DUCKDB_API bool OnDiskFile();
+	DUCKDB_API bool SupportsPositionalReads();
 	DUCKDB_API idx_t GetFileSize();
 	DUCKDB_API FileType GetType();
 
@@ -227,6 +228,9 @@ public:
 	//! Whether or not the FS handles plain files on disk. This is relevant for certain optimizations, as random reads
 	//! in a file on-disk are much cheaper than e.g. random reads in a file over the network
 	DUCKDB_API virtual bool OnDiskFile(FileHandle &handle);
+	//! Whether or not reads at a location leave the state of the handle untouched, so that multiple threads can read
+	//! from a handle that was opened with FILE_FLAGS_PARALLEL_ACCESS at the same time
+	DUCKDB_API virtual bool SupportsPositionalReads(FileHandle &handle);
 
 	DUCKDB_API virtual unique_ptr<FileHandle> OpenCompressedFile(unique_ptr<FileHandle> handle, bool write);
 
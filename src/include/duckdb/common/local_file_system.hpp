@@ -84,6 +84,8 @@ public:
 	//! Whether or not the FS handles plain files on disk. This is relevant for certain optimizations, as random reads
 	//! in a file on-disk are much cheaper than e.g. random reads in a file over the network
 	bool OnDiskFile(FileHandle &handle) override;
+	//! Reads at a location do not depend on the position of the handle
+	bool SupportsPositionalReads(FileHandle &handle) override;
 
 	std::string GetName() const override {
 		return "LocalFileSystem";
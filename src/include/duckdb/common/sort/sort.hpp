@@ -22,6 +22,12 @@ struct SortConstants {
 	static constexpr idx_t MSD_RADIX_LOCATIONS = VALUES_PER_RADIX + 1;
 	static constexpr idx_t INSERTION_SORT_THRESHOLD = 24;
 	static constexpr idx_t MSD_RADIX_SORT_SIZE_THRESHOLD = 4;
+	//! Strings up to this length (according to the statistics) are sorted on their full value instead of a prefix
+	static constexpr idx_t MAX_FULL_STRING_KEY_SIZE = 32;
+	//! The maximum number of sorted blocks that are merged into one at once
+	static constexpr idx_t MERGE_FAN_IN = 32;
+	//! The maximum number of sorted blocks that are merged into one at once during an external sort
+	static constexpr idx_t EXTERNAL_MERGE_FAN_IN = 4;
 };
 
 struct SortLayout {
@@ -91,11 +97,17 @@ public:
 	//! Whether we are doing an external sort
 	bool external;
 
-	//! Progress in merge path stage
-	idx_t pair_idx;
-	idx_t num_pairs;
-	idx_t l_start;
-	idx_t r_start;
+	//! The number of sorted blocks that are merged into one in the current round
+	idx_t merge_fan_in;
+	//! Progress in the k-way merge stage
+	idx_t merge_idx;
+	idx_t num_merges;
+	//! The number of partitions of the current merge that have been assigned to a thread
+	idx_t merge_partition_idx;
+	//! The entries of the sorted blocks of the current merge that precede all unassigned partitions
+	vector<idx_t> merge_starts;
+	//! The number of assigned partitions of each merge whose slices have not been created yet
+	vector<idx_t> merge_active;
 };
 
 struct LocalSortState {
@@ -161,47 +173,51 @@ private:
 	BufferManager &buffer_manager;
 	const SortLayout &sort_layout;
 
-	//! The left and right reader
-	unique_ptr<SBScanState> left;
-	unique_ptr<SBScanState> right;
-
-	//! Input and output blocks
-	unique_ptr<SortedBlock> left_input;
-	unique_ptr<SortedBlock> right_input;
+	//! The slices of the sorted blocks that are merged into the current partition
+	vector<unique_ptr<SortedBlock>> inputs;
+	//! The readers that copy the merged data from the inputs
+	vector<unique_ptr<SBScanState>> readers;
+	//! The readers that compare the next entries of the inputs
+	vector<unique_ptr<SBScanState>> heads;
+	//! The output block
 	SortedBlock *result;
 
+	//! Loser tree over the heads: tree[0] holds the input with the smallest head,
+	//! the other nodes hold the input that lost the match at that node
+	vector<idx_t> tree;
+	//! The number of leaves of the loser tree (a power of two)
+	idx_t leaf_count;
+
 private:
-	//! Computes the left and right block that will be merged next (Merge Path partition)
-	void GetNextPartition();
-	//! Finds the boundary of the next partition using binary search
-	void GetIntersection(const idx_t diagonal, idx_t &l_idx, idx_t &r_idx);
+	//! Assigns the next partition of the current merge to this thread (must hold the lock)
+	void AssignPartition(idx_t &merge_idx, idx_t &partition_idx, vector<idx_t> &starts);
+	//! Computes the slices of the blocks that are merged into the assigned partition (multi-way Merge Path partition)
+	void GetPartition(const idx_t merge_idx, const idx_t partition_idx, const vector<idx_t> &starts);
+	//! Finds the end of the first 'count' entries that come after 'starts' in the blocks of merge 'merge_idx'
+	void GetIntersection(const idx_t merge_idx, const idx_t count, const vector<idx_t> &starts,
+	                     const vector<idx_t> &block_counts, vector<idx_t> &ends);
+	//! Finds the first entry in [lo, hi) of 'r' that is greater than (or equal to, if 'upper' is false) pivot 'l_idx'
+	idx_t BinarySearch(SBScanState &l, const idx_t l_idx, SBScanState &r, idx_t lo, idx_t hi, bool upper);
 	//! Compare values within SortedBlocks using a global index
 	int CompareUsingGlobalIndex(SBScanState &l, SBScanState &r, const idx_t l_idx, const idx_t r_idx);
 
 	//! Finds the next partition and merges it
 	void MergePartition();
 
-	//! Computes how the next 'count' tuples should be merged by setting the 'left_smaller' array
-	void ComputeMerge(const idx_t &count, bool left_smaller[]);
-
-	//! Merges the radix sorting blocks according to the 'left_smaller' array
-	void MergeRadix(const idx_t &count, const bool left_smaller[]);
-	//! Merges SortedData according to the 'left_smaller' array
-	void MergeData(SortedData &result_data, SortedData &l_data, SortedData &r_data, const idx_t &count,
-	               const bool left_smaller[], idx_t next_entry_sizes[], bool reset_indices);
-	//! Merges constant size rows according to the 'left_smaller' array
-	void MergeRows(data_ptr_t &l_ptr, idx_t &l_entry_idx, const idx_t &l_count, data_ptr_t &r_ptr, idx_t &r_entry_idx,
-	               const idx_t &r_count, RowDataBlock &target_block, data_ptr_t &target_ptr, const idx_t &entry_size,
-	               const bool left_smaller[], idx_t &copied, const idx_t &count);
-	//! Flushes constant size rows into the result
-	void FlushRows(data_ptr_t &source_ptr, idx_t &source_entry_idx, const idx_t &source_count,
-	               RowDataBlock &target_block, data_ptr_t &target_ptr, const idx_t &entry_size, idx_t &copied,
-	               const idx_t &count);
-	//! Flushes blob rows and accompanying heap
-	void FlushBlobs(const RowLayout &layout, const idx_t &source_count, data_ptr_t &source_data_ptr,
-	                idx_t &source_entry_idx, data_ptr_t &source_heap_ptr, RowDataBlock &target_data_block,
-	                data_ptr_t &target_data_ptr, RowDataBlock &target_heap_block, BufferHandle &target_heap_handle,
-	                data_ptr_t &target_heap_ptr, idx_t &copied, const idx_t &count);
+	//! Whether the head of input 'l' comes before the head of input 'r'
+	bool HeadIsSmaller(const idx_t l, const idx_t r);
+	//! Moves the head of an input to its next entry
+	void AdvanceHead(SBScanState &head);
+	//! Builds the loser tree over the heads of the inputs
+	void InitializeTree();
+	//! Computes how the next 'count' tuples should be merged by setting the input that each tuple comes from
+	void ComputeMerge(const idx_t &count, idx_t sources[]);
+
+	//! Merges the radix sorting blocks according to the 'sources' array
+	void MergeRadix(const idx_t &count, const idx_t sources[]);
+	//! Merges SortedData according to the 'sources' array
+	void MergeData(SortedData &result_data, SortedDataType type, const idx_t &count, const idx_t sources[],
+	               bool reset_indices);
 };
 
 struct SBIterator {
@@ -50,6 +50,11 @@ public:
 	void Serialize(Serializer &serializer) const;
 	static unique_ptr<HyperLogLog> Deserialize(Deserializer &deserializer);
 
+	//! Write the HLL as a compact sketch that can be stored in a BLOB and merged later on
+	string ToSketch() const;
+	//! Read a HLL from a sketch that was created by ToSketch
+	static unique_ptr<HyperLogLog> FromSketch(const_data_ptr_t data, idx_t size);
+
 public:
 	//! Compute HLL hashes over vdata, and store them in 'hashes'
 	//! Then, compute register indices and prefix lengths, and also store them in 'hashes' as a pair of uint32_t
@@ -24,6 +24,33 @@ struct ApproxCountDistinctFun {
 	static AggregateFunctionSet GetFunctions();
 };
 
+struct HllSketchFun {
+	static constexpr const char *Name = "hll_sketch";
+	static constexpr const char *Parameters = "x";
+	static constexpr const char *Description = "Computes a HyperLogLog sketch of the distinct elements that can be stored, merged with hll_merge and estimated with hll_estimate.";
+	static constexpr const char *Example = "hll_sketch(A)";
+
+	static AggregateFunctionSet GetFunctions();
+};
+
+struct HllMergeFun {
+	static constexpr const char *Name = "hll_merge";
+	static constexpr const char *Parameters = "sketch";
+	static constexpr const char *Description = "Merges HyperLogLog sketches created by hll_sketch into a single sketch.";
+	static constexpr const char *Example = "hll_merge(A)";
+
+	static AggregateFunction GetFunction();
+};
+
+struct HllEstimateFun {
+	static constexpr const char *Name = "hll_estimate";
+	static constexpr const char *Parameters = "sketch";
+	static constexpr const char *Description = "Returns the approximate count of distinct elements of a HyperLogLog sketch.";
+	static constexpr const char *Example = "hll_estimate(hll_sketch(A))";
+
+	static ScalarFunction GetFunction();
+};
+
 struct ArgMinFun {
 	static constexpr const char *Name = "arg_min";
 	static constexpr const char *Parameters = "arg,val";
@@ -24,6 +24,33 @@ struct ApproxQuantileFun {
 	static AggregateFunctionSet GetFunctions();
 };
 
+struct TdigestSketchFun {
+	static constexpr const char *Name = "tdigest_sketch";
+	static constexpr const char *Parameters = "x";
+	static constexpr const char *Description = "Computes a T-Digest sketch of the values that can be stored, merged with tdigest_merge and queried with tdigest_quantile.";
+	static constexpr const char *Example = "tdigest_sketch(A)";
+
+	static AggregateFunction GetFunction();
+};
+
+struct TdigestMergeFun {
+	static constexpr const char *Name = "tdigest_merge";
+	static constexpr const char *Parameters = "sketch";
+	static constexpr const char *Description = "Merges T-Digest sketches created by tdigest_sketch into a single sketch.";
+	static constexpr const char *Example = "tdigest_merge(A)";
+
+	static AggregateFunction GetFunction();
+};
+
+struct TdigestQuantileFun {
+	static constexpr const char *Name = "tdigest_quantile";
+	static constexpr const char *Parameters = "sketch,pos";
+	static constexpr const char *Description = "Returns the approximate quantile of a T-Digest sketch.";
+	static constexpr const char *Example = "tdigest_quantile(tdigest_sketch(A),0.5)";
+
+	static ScalarFunction GetFunction();
+};
+
 struct MadFun {
 	static constexpr const char *Name = "mad";
 	static constexpr const char *Parameters = "x";
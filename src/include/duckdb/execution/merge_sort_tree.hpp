@@ -9,12 +9,15 @@
 #pragma once
 
 #include "duckdb/common/array.hpp"
+#include "duckdb/common/atomic.hpp"
 #include "duckdb/common/helper.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/common/pair.hpp"
 #include "duckdb/common/printer.hpp"
 #include "duckdb/common/typedefs.hpp"
 #include "duckdb/common/vector.hpp"
 #include "duckdb/common/vector_operations/aggregate_executor.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include <iomanip>
 
 namespace duckdb {
@@ -100,10 +103,24 @@ struct MergeSortTree {
 		CMP cmp;
 	};
 
-	explicit MergeSortTree(const CMP &cmp = CMP()) : cmp(cmp) {
+	explicit MergeSortTree(const CMP &cmp = CMP()) : cmp(cmp), build_level(0), build_run(0), build_complete(0) {
 	}
 	explicit MergeSortTree(Elements &&lowest_level, const CMP &cmp = CMP());
 
+	//! Size the levels of the tree for the given lowest level, without building them
+	void Allocate(Elements &&lowest_level);
+	//! Build the allocated levels of the tree. Any number of threads can call this concurrently:
+	//! the runs of each level are claimed one at a time and the call returns when the whole tree is built.
+	void Build();
+	//! Claim the next run to build. Returns false if there is nothing to claim right now.
+	bool TryNextRun(idx_t &level_idx, idx_t &run_idx);
+	//! Build a single run of a level by merging the child runs of the level below
+	void BuildRun(idx_t level_idx, idx_t run_idx);
+	//! Whether all the levels of the tree have been built
+	bool IsBuilt() const {
+		return build_level >= tree.size();
+	}
+
 	idx_t SelectNth(const SubFrames &frames, idx_t n) const;
 
 	inline ElementType NthElement(idx_t i) const {
@@ -116,10 +133,31 @@ struct MergeSortTree {
 	Tree tree;
 	CompareElements cmp;
 
+	//! Synchronises the claiming of runs during a concurrent build
+	mutex build_lock;
+	//! The level currently being built
+	atomic<idx_t> build_level;
+	//! The next run of the current level to claim
+	idx_t build_run;
+	//! The number of runs of the current level that have been built
+	atomic<idx_t> build_complete;
+
 	static constexpr auto FANOUT = F;
 	static constexpr auto CASCADING = C;
 
 protected:
+	idx_t NumRuns(idx_t level_idx) const {
+		if (level_idx >= tree.size()) {
+			return 0;
+		}
+		idx_t run_length = 1;
+		for (idx_t i = 0; i < level_idx; ++i) {
+			run_length *= FANOUT;
+		}
+		const auto count = tree[0].first.size();
+		return (count + run_length - 1) / run_length;
+	}
+
 	RunElement StartGames(Games &losers, const RunElements &elements, const RunElement &sentinel) {
 		const auto elem_nodes = elements.size();
 		const auto game_nodes = losers.size();
@@ -250,93 +288,167 @@ protected:
 };
 
 template <typename E, typename O, typename CMP, uint64_t F, uint64_t C>
-MergeSortTree<E, O, CMP, F, C>::MergeSortTree(Elements &&lowest_level, const CMP &cmp) : cmp(cmp) {
+MergeSortTree<E, O, CMP, F, C>::MergeSortTree(Elements &&lowest_level, const CMP &cmp)
+    : cmp(cmp), build_level(0), build_run(0), build_complete(0) {
+	Allocate(std::move(lowest_level));
+	Build();
+}
+
+template <typename E, typename O, typename CMP, uint64_t F, uint64_t C>
+void MergeSortTree<E, O, CMP, F, C>::Allocate(Elements &&lowest_level) {
 	const auto fanout = F;
 	const auto cascading = C;
 	const auto count = lowest_level.size();
+	tree.clear();
 	tree.emplace_back(Level(std::move(lowest_level), Offsets()));
 
-	const RunElement SENTINEL(MergeSortTraits<ElementType>::SENTINEL(), MergeSortTraits<idx_t>::SENTINEL());
-
-	//	Fan in parent levels until we are at the top
+	//	Size all parent levels up front so the runs of a level can be built independently.
 	//	Note that we don't build the top layer as that would just be all the data.
 	for (idx_t child_run_length = 1; child_run_length < count;) {
 		const auto run_length = child_run_length * fanout;
 		const auto num_runs = (count + run_length - 1) / run_length;
 
-		Elements elements;
-		elements.reserve(count);
+		Elements elements(count);
 
 		//	Allocate cascading pointers only if there is room
 		Offsets cascades;
 		if (cascading > 0 && run_length > cascading) {
 			const auto num_cascades = fanout * num_runs * (run_length / cascading + 2);
-			cascades.reserve(num_cascades);
+			cascades.resize(num_cascades);
 		}
 
-		//	Create each parent run by merging the child runs using a tournament tree
-		// 	https://en.wikipedia.org/wiki/K-way_merge_algorithm
-		//	TODO: Because the runs are independent, they can be parallelised with parallel_for
-		const auto &child_level = tree.back();
-		for (idx_t run_idx = 0; run_idx < num_runs; ++run_idx) {
-			//	Position markers for scanning the children.
-			using Bounds = pair<idx_t, idx_t>;
-			array<Bounds, fanout> bounds;
-			//	Start with first element of each (sorted) child run
-			RunElements players;
-			const auto child_base = run_idx * run_length;
-			for (idx_t child_run = 0; child_run < fanout; ++child_run) {
-				const auto child_idx = child_base + child_run * child_run_length;
-				bounds[child_run] = {MinValue<idx_t>(child_idx, count),
-				                     MinValue<idx_t>(child_idx + child_run_length, count)};
-				if (bounds[child_run].first != bounds[child_run].second) {
-					players[child_run] = {child_level.first[child_idx], child_run};
-				} else {
-					//	Empty child
-					players[child_run] = SENTINEL;
-				}
-			}
+		tree.emplace_back(std::move(elements), std::move(cascades));
+		child_run_length = run_length;
+	}
 
-			//	Play the first round and extract the winner
-			Games games;
-			auto winner = StartGames(games, players, SENTINEL);
-			while (winner != SENTINEL) {
-				// Add fractional cascading pointers
-				// if we are on a fraction boundary
-				if (cascading > 0 && run_length > cascading && elements.size() % cascading == 0) {
-					for (idx_t i = 0; i < fanout; ++i) {
-						cascades.emplace_back(bounds[i].first);
-					}
-				}
+	build_level = 1;
+	build_run = 0;
+	build_complete = 0;
+}
 
-				//	Insert new winner element into the current run
-				elements.emplace_back(winner.first);
-				const auto child_run = winner.second;
-				auto &child_idx = bounds[child_run].first;
-				++child_idx;
-
-				//	Move to the next entry in the child run (if any)
-				if (child_idx < bounds[child_run].second) {
-					winner = ReplayGames(games, child_run, {child_level.first[child_idx], child_run});
-				} else {
-					winner = ReplayGames(games, child_run, SENTINEL);
-				}
-			}
+template <typename E, typename O, typename CMP, uint64_t F, uint64_t C>
+bool MergeSortTree<E, O, CMP, F, C>::TryNextRun(idx_t &level_idx, idx_t &run_idx) {
+	lock_guard<mutex> stage_guard(build_lock);
+
+	//	Finished with this level?
+	if (build_complete >= NumRuns(build_level)) {
+		++build_level;
+		build_run = 0;
+		build_complete = 0;
+	}
 
-			// Add terminal cascade pointers to the end
-			if (cascading > 0 && run_length > cascading) {
-				for (idx_t j = 0; j < 2; ++j) {
-					for (idx_t i = 0; i < fanout; ++i) {
-						cascades.emplace_back(bounds[i].first);
-					}
-				}
+	if (build_level >= tree.size()) {
+		return false;
+	}
+
+	//	All runs of this level are claimed, but the level is not complete yet
+	if (build_run >= NumRuns(build_level)) {
+		return false;
+	}
+
+	level_idx = build_level;
+	run_idx = build_run++;
+
+	return true;
+}
+
+template <typename E, typename O, typename CMP, uint64_t F, uint64_t C>
+void MergeSortTree<E, O, CMP, F, C>::Build() {
+	//	Claim runs until the whole tree is built,
+	//	waiting for the other threads to finish a level before moving to the next one
+	while (build_level < tree.size()) {
+		idx_t level_idx;
+		idx_t run_idx;
+		if (TryNextRun(level_idx, run_idx)) {
+			BuildRun(level_idx, run_idx);
+		} else {
+			TaskScheduler::YieldThread();
+		}
+	}
+}
+
+template <typename E, typename O, typename CMP, uint64_t F, uint64_t C>
+void MergeSortTree<E, O, CMP, F, C>::BuildRun(idx_t level_idx, idx_t run_idx) {
+	const auto fanout = F;
+	const auto cascading = C;
+	const auto count = tree[0].first.size();
+
+	const RunElement SENTINEL(MergeSortTraits<ElementType>::SENTINEL(), MergeSortTraits<idx_t>::SENTINEL());
+
+	idx_t child_run_length = 1;
+	for (idx_t i = 1; i < level_idx; ++i) {
+		child_run_length *= fanout;
+	}
+	const auto run_length = child_run_length * fanout;
+
+	//	Each run writes to its own slice of the level, so runs can be built concurrently
+	auto &parent_level = tree[level_idx];
+	auto elements = parent_level.first.data() + run_idx * run_length;
+	idx_t num_elements = 0;
+
+	const auto has_cascades = cascading > 0 && run_length > cascading;
+	OffsetType *cascades = nullptr;
+	if (has_cascades) {
+		cascades = parent_level.second.data() + run_idx * fanout * (run_length / cascading + 2);
+	}
+
+	//	Create the parent run by merging the child runs using a tournament tree
+	// 	https://en.wikipedia.org/wiki/K-way_merge_algorithm
+	const auto &child_level = tree[level_idx - 1];
+
+	//	Position markers for scanning the children.
+	using Bounds = pair<idx_t, idx_t>;
+	array<Bounds, fanout> bounds;
+	//	Start with first element of each (sorted) child run
+	RunElements players;
+	const auto child_base = run_idx * run_length;
+	for (idx_t child_run = 0; child_run < fanout; ++child_run) {
+		const auto child_idx = child_base + child_run * child_run_length;
+		bounds[child_run] = {MinValue<idx_t>(child_idx, count), MinValue<idx_t>(child_idx + child_run_length, count)};
+		if (bounds[child_run].first != bounds[child_run].second) {
+			players[child_run] = {child_level.first[child_idx], child_run};
+		} else {
+			//	Empty child
+			players[child_run] = SENTINEL;
+		}
+	}
+
+	//	Play the first round and extract the winner
+	Games games;
+	auto winner = StartGames(games, players, SENTINEL);
+	while (winner != SENTINEL) {
+		// Add fractional cascading pointers
+		// if we are on a fraction boundary
+		if (has_cascades && num_elements % cascading == 0) {
+			for (idx_t i = 0; i < fanout; ++i) {
+				*cascades++ = bounds[i].first;
 			}
 		}
 
-		//	Insert completed level and move up to the next one
-		tree.emplace_back(std::move(elements), std::move(cascades));
-		child_run_length = run_length;
+		//	Insert new winner element into the current run
+		elements[num_elements++] = winner.first;
+		const auto child_run = winner.second;
+		auto &child_idx = bounds[child_run].first;
+		++child_idx;
+
+		//	Move to the next entry in the child run (if any)
+		if (child_idx < bounds[child_run].second) {
+			winner = ReplayGames(games, child_run, {child_level.first[child_idx], child_run});
+		} else {
+			winner = ReplayGames(games, child_run, SENTINEL);
+		}
 	}
+
+	// Add terminal cascade pointers to the end
+	if (has_cascades) {
+		for (idx_t j = 0; j < 2; ++j) {
+			for (idx_t i = 0; i < fanout; ++i) {
+				*cascades++ = bounds[i].first;
+			}
+		}
+	}
+
+	++build_complete;
 }
 
 template <typename E, typename O, typename CMP, uint64_t F, uint64_t C>
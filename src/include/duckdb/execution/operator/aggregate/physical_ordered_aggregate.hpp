@@ -0,0 +1,86 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/aggregate/physical_ordered_aggregate.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/types/row/tuple_data_layout.hpp"
+#include "duckdb/execution/operator/aggregate/aggregate_object.hpp"
+#include "duckdb/execution/physical_operator.hpp"
+
+namespace duckdb {
+
+//! PhysicalOrderedAggregate performs a group-by and aggregation on input that is (mostly) ordered on the groups.
+//! Instead of building a hash table, consecutive rows with the same groups are aggregated into a single state. Each
+//! batch of the input is aggregated separately, after which the runs of the batches are merged in batch order. If
+//! the input turns out not to be ordered, the runs are sorted before they are merged. If the input is known to be
+//! ordered on all groups, the runs are finalized as soon as they end, and only the first and the last run of every
+//! batch are kept until they are merged.
+class PhysicalOrderedAggregate : public PhysicalOperator {
+public:
+	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::ORDERED_GROUP_BY;
+
+public:
+	PhysicalOrderedAggregate(ClientContext &context, vector<LogicalType> types,
+	                         vector<unique_ptr<Expression>> aggregates, vector<unique_ptr<Expression>> groups,
+	                         bool input_ordered, idx_t estimated_cardinality);
+
+	//! The groups
+	vector<unique_ptr<Expression>> groups;
+	//! Whether or not the input is guaranteed to be ordered on all groups, i.e. it does not have to be verified
+	bool input_ordered;
+	//! The aggregates that have to be computed
+	vector<unique_ptr<Expression>> aggregates;
+
+public:
+	// Source interface
+	unique_ptr<GlobalSourceState> GetGlobalSourceState(ClientContext &context) const override;
+	SourceResultType GetData(ExecutionContext &context, DataChunk &chunk, OperatorSourceInput &input) const override;
+
+	bool IsSource() const override {
+		return true;
+	}
+
+public:
+	// Sink interface
+	SinkResultType Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const override;
+	SinkCombineResultType Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const override;
+	SinkNextBatchType NextBatch(ExecutionContext &context, OperatorSinkNextBatchInput &input) const override;
+	SinkFinalizeType Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+	                          OperatorSinkFinalizeInput &input) const override;
+
+	unique_ptr<LocalSinkState> GetLocalSinkState(ExecutionContext &context) const override;
+	unique_ptr<GlobalSinkState> GetGlobalSinkState(ClientContext &context) const override;
+
+	string ParamsToString() const override;
+
+	bool IsSink() const override {
+		return true;
+	}
+
+	bool ParallelSink() const override {
+		return true;
+	}
+
+	bool RequiresBatchIndex() const override {
+		return true;
+	}
+
+public:
+	//! The group types
+	vector<LogicalType> group_types;
+	//! The payload types
+	vector<LogicalType> payload_types;
+	//! The aggregates to be computed
+	vector<AggregateObject> aggregate_objects;
+	//! The layout of the aggregate states of a group
+	TupleDataLayout layout;
+
+	unordered_map<Expression *, size_t> filter_indexes;
+};
+
+} // namespace duckdb
@@ -18,6 +18,12 @@ class PhysicalStreamingWindow : public PhysicalOperator {
 public:
 	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::STREAMING_WINDOW;
 
+	//! The maximum number of preceding rows that are carried between chunks (for LAG and ROWS n PRECEDING)
+	static constexpr const idx_t MAX_BUFFERED_ROWS = STANDARD_VECTOR_SIZE - 1;
+
+	//! Whether the window function can be computed by streaming the input
+	static bool IsStreamingFunction(ClientContext &context, unique_ptr<Expression> &expr);
+
 public:
 	PhysicalStreamingWindow(vector<LogicalType> types, vector<unique_ptr<Expression>> select_list,
 	                        idx_t estimated_cardinality,
@@ -38,6 +44,12 @@ public:
 	}
 
 	string ParamsToString() const override;
+
+private:
+	void ExecuteLag(ExecutionContext &context, DataChunk &input, Vector &result, OperatorState &state,
+	                idx_t expr_idx) const;
+	void ExecuteFrameAggregate(ExecutionContext &context, DataChunk &input, Vector &result,
+	                           GlobalOperatorState &gstate, OperatorState &state, idx_t expr_idx) const;
 };
 
 } // namespace duckdb
@@ -13,6 +13,7 @@
 #include "duckdb/execution/operator/csv_scanner/csv_state_machine.hpp"
 #include "duckdb/execution/operator/csv_scanner/csv_error.hpp"
 #include "duckdb/common/helper.hpp"
+#include "duckdb/common/bit_utils.hpp"
 
 namespace duckdb {
 
@@ -115,8 +116,41 @@ protected:
 	//! Initializes the scanner
 	virtual void Initialize();
 
-	inline bool ContainsZeroByte(uint64_t v) {
-		return (v - UINT64_C(0x0101010101010101)) & ~(v)&UINT64_C(0x8080808080808080);
+	//! Returns a mask flagging the bytes of v that are equal to any of the (broadcast) characters a, b or c
+	static inline uint64_t MatchMask(uint64_t v, uint64_t a, uint64_t b, uint64_t c) {
+		return SWAR::ZeroByteMask(v ^ a) | SWAR::ZeroByteMask(v ^ b) | SWAR::ZeroByteMask(v ^ c);
+	}
+
+	//! Returns the position of the first byte starting from pos that is equal to any of the (broadcast) characters a,
+	//! b or c. The buffer is compared a word at a time, four words per iteration; the remaining bytes that do not fill
+	//! up a word before to_pos are left to the caller.
+	inline idx_t SkipToCharacter(idx_t pos, const idx_t to_pos, uint64_t a, uint64_t b, uint64_t c) {
+		static constexpr idx_t WORD_SIZE = sizeof(uint64_t);
+		static constexpr idx_t BLOCK_WORDS = 4;
+		auto ptr = reinterpret_cast<const_data_ptr_t>(buffer_handle_ptr);
+		while (pos + BLOCK_WORDS * WORD_SIZE < to_pos) {
+			uint64_t masks[BLOCK_WORDS];
+			for (idx_t w = 0; w < BLOCK_WORDS; w++) {
+				masks[w] = MatchMask(Load<uint64_t>(ptr + pos + w * WORD_SIZE), a, b, c);
+			}
+			if (!(masks[0] | masks[1] | masks[2] | masks[3])) {
+				pos += BLOCK_WORDS * WORD_SIZE;
+				continue;
+			}
+			for (idx_t w = 0; w < BLOCK_WORDS; w++) {
+				if (masks[w]) {
+					return pos + w * WORD_SIZE + SWAR::FirstFlaggedByte(masks[w]);
+				}
+			}
+		}
+		while (pos + WORD_SIZE < to_pos) {
+			auto mask = MatchMask(Load<uint64_t>(ptr + pos), a, b, c);
+			if (mask) {
+				return pos + SWAR::FirstFlaggedByte(mask);
+			}
+			pos += WORD_SIZE;
+		}
+		return pos;
 	}
 
 	//! Process one chunk
@@ -191,15 +225,9 @@ protected:
 				ever_quoted = true;
 				T::SetQuoted(result, iterator.pos.buffer_pos);
 				iterator.pos.buffer_pos++;
-				while (iterator.pos.buffer_pos + 8 < to_pos) {
-					uint64_t value =
-					    Load<uint64_t>(reinterpret_cast<const_data_ptr_t>(&buffer_handle_ptr[iterator.pos.buffer_pos]));
-					if (ContainsZeroByte((value ^ state_machine->transition_array.quote) &
-					                     (value ^ state_machine->transition_array.escape))) {
-						break;
-					}
-					iterator.pos.buffer_pos += 8;
-				}
+				iterator.pos.buffer_pos = SkipToCharacter(
+				    iterator.pos.buffer_pos, to_pos, state_machine->transition_array.quote,
+				    state_machine->transition_array.escape, state_machine->transition_array.escape);
 
 				while (state_machine->transition_array
 				           .skip_quoted[static_cast<uint8_t>(buffer_handle_ptr[iterator.pos.buffer_pos])] &&
@@ -213,16 +241,9 @@ protected:
 				break;
 			case CSVState::STANDARD: {
 				iterator.pos.buffer_pos++;
-				while (iterator.pos.buffer_pos + 8 < to_pos) {
-					uint64_t value =
-					    Load<uint64_t>(reinterpret_cast<const_data_ptr_t>(&buffer_handle_ptr[iterator.pos.buffer_pos]));
-					if (ContainsZeroByte((value ^ state_machine->transition_array.delimiter) &
-					                     (value ^ state_machine->transition_array.new_line) &
-					                     (value ^ state_machine->transition_array.carriage_return))) {
-						break;
-					}
-					iterator.pos.buffer_pos += 8;
-				}
+				iterator.pos.buffer_pos = SkipToCharacter(
+				    iterator.pos.buffer_pos, to_pos, state_machine->transition_array.delimiter,
+				    state_machine->transition_array.new_line, state_machine->transition_array.carriage_return);
 				while (state_machine->transition_array
 				           .skip_standard[static_cast<uint8_t>(buffer_handle_ptr[iterator.pos.buffer_pos])] &&
 				       iterator.pos.buffer_pos < to_pos - 1) {
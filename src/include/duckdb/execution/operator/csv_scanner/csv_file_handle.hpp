@@ -34,6 +34,9 @@ public:
 
 	idx_t FileSize();
 
+	//! The last modification time of the file, only available for files we can seek in
+	time_t LastModifiedTime();
+
 	bool FinishedReading();
 
 	idx_t Read(void *buffer, idx_t nr_bytes);
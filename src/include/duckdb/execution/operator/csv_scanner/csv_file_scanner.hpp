@@ -22,12 +22,13 @@ public:
 	//! This means the options are alreadu set, and the buffer manager is already up and runinng.
 	CSVFileScan(ClientContext &context, shared_ptr<CSVBufferManager> buffer_manager,
 	            shared_ptr<CSVStateMachine> state_machine, const CSVReaderOptions &options,
-	            const ReadCSVData &bind_data, const vector<column_t> &column_ids, vector<LogicalType> &file_schema);
+	            const ReadCSVData &bind_data, const vector<column_t> &column_ids, vector<LogicalType> &file_schema,
+	            optional_ptr<TableFilterSet> filters);
 	//! Constructor for new CSV Files, we must initialize the buffer manager and the state machine
 	//! Path to this file
 	CSVFileScan(ClientContext &context, const string &file_path, const CSVReaderOptions &options, const idx_t file_idx,
 	            const ReadCSVData &bind_data, const vector<column_t> &column_ids,
-	            const vector<LogicalType> &file_schema);
+	            const vector<LogicalType> &file_schema, optional_ptr<TableFilterSet> filters);
 
 	CSVFileScan(ClientContext &context, const string &file_name, CSVReaderOptions &options);
 
@@ -39,6 +40,10 @@ public:
 
 	//! Initialize the actual names and types to be scanned from the file
 	void InitializeFileNamesTypes();
+	//! The index in the result chunk of the column at this position in the parsed chunk
+	idx_t GetResultIndex(idx_t col_idx) const;
+	//! The filter that was pushed into the scan on the column at this position in the parsed chunk, if any
+	optional_ptr<TableFilter> GetColumnFilter(idx_t col_idx) const;
 	const string file_path;
 	//! File Index
 	idx_t file_idx;
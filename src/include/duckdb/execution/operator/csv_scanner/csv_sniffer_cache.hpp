@@ -0,0 +1,85 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/csv_scanner/csv_sniffer_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/list.hpp"
+#include "duckdb/execution/operator/csv_scanner/csv_sniffer.hpp"
+#include "duckdb/storage/object_cache.hpp"
+
+namespace duckdb {
+
+//! The outcome of sniffing a single file with a given set of options
+struct CSVSnifferCacheEntry {
+	CSVSnifferCacheEntry(SnifferResult result_p, const CSVReaderOptions &options, idx_t file_size_p,
+	                     time_t last_modified_p, time_t read_time_p)
+	    : result(std::move(result_p)), dialect_options(options.dialect_options),
+	      sniffer_user_mismatch_error(options.sniffer_user_mismatch_error),
+	      was_type_manually_set(options.was_type_manually_set), file_size(file_size_p),
+	      last_modified(last_modified_p), read_time(read_time_p) {
+	}
+
+	//! The types and names returned by the sniffer
+	SnifferResult result;
+	//! The options that were set by the sniffer
+	DialectOptions dialect_options;
+	string sniffer_user_mismatch_error;
+	vector<bool> was_type_manually_set;
+	//! The size and modification time of the file when it was sniffed, used to detect changes to the file
+	idx_t file_size;
+	time_t last_modified;
+	//! The time at which the file was sniffed
+	time_t read_time;
+};
+
+//! The CSVSnifferCache remembers the results of sniffing files, so that repeatedly scanning the same (set of) files
+//! does not have to run the sniffer on every bind. Results are keyed on the file path and all options that influence
+//! the sniffer, and are only reused if the size and modification time of the file have not changed.
+//! Like the Parquet metadata cache, the sniffer cache is only used when the object cache is enabled. It holds at most
+//! MAX_ENTRIES results, the least recently used results are evicted first.
+class CSVSnifferCache : public ObjectCacheEntry {
+public:
+	static constexpr idx_t MAX_ENTRIES = 1024;
+
+	CSVSnifferCache() = default;
+	~CSVSnifferCache() override = default;
+
+	static CSVSnifferCache &Get(ClientContext &context);
+
+	//! Sniffs the file of the buffer manager, or reuses the result of an earlier sniff of the same unchanged file with
+	//! the same options. Modifies the options in the same way as CSVSniffer::SniffCSV.
+	static SnifferResult SniffCSV(ClientContext &context, CSVReaderOptions &options,
+	                              shared_ptr<CSVBufferManager> buffer_manager, SetColumns set_columns = {},
+	                              bool force_match = false);
+
+	static string ObjectType() {
+		return "CSV_SNIFFER_CACHE";
+	}
+
+	string GetObjectType() override {
+		return ObjectType();
+	}
+
+private:
+	//! Returns the key under which the sniffing result for a file is stored
+	static string GetKey(const string &file_path, const CSVReaderOptions &options, SetColumns &set_columns);
+
+	//! Returns the entry for the key (and marks it as most recently used), or nullptr if there is none
+	shared_ptr<CSVSnifferCacheEntry> Find(const string &key);
+	//! Adds or replaces the entry for the key, and evicts the least recently used entry if the cache is full
+	void Insert(const string &key, shared_ptr<CSVSnifferCacheEntry> entry);
+
+	//! The keys of the cache, most recently used first
+	list<string> lru;
+	//! Cache on file path and options, with the position of the key in the LRU list
+	unordered_map<string, pair<shared_ptr<CSVSnifferCacheEntry>, list<string>::iterator>> sniffer_cache;
+	//! The cache can be accessed in parallel by the file scans
+	mutex main_mutex;
+};
+
+} // namespace duckdb
@@ -14,6 +14,7 @@
 #include "duckdb/execution/operator/csv_scanner/base_scanner.hpp"
 
 namespace duckdb {
+class TableFilter;
 
 struct CSVBufferUsage {
 	CSVBufferUsage(CSVBufferManager &buffer_manager_p, idx_t buffer_idx_p)
@@ -229,6 +230,13 @@ private:
 
 	void SetStart();
 
+	//! Converts the parsed values of a column to the type of the result vector
+	void ConvertColumn(DataChunk &parse_chunk, idx_t col_idx, Vector &result_vector,
+	                   unordered_set<idx_t> &borked_lines);
+	//! Applies a pushed down table filter to a converted column, narrowing down the approved rows in sel
+	static void ApplyFilter(Vector &vector, const TableFilter &filter, idx_t count, SelectionVector &sel,
+	                        idx_t &approved_count);
+
 	StringValueResult result;
 	vector<LogicalType> types;
 
@@ -0,0 +1,72 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/order/physical_partitioned_top_n.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/physical_operator.hpp"
+#include "duckdb/planner/bound_query_node.hpp"
+
+namespace duckdb {
+
+//! PhysicalPartitionedTopN computes ROW_NUMBER() OVER (PARTITION BY ... ORDER BY ...) for only the first "limit" rows
+//! of every partition, which is all that a filter such as QUALIFY row_number() OVER (...) <= k needs. Instead of
+//! sorting the entire input, the collected rows are periodically sorted and reduced to the first rows of each
+//! partition, so the operator only keeps (roughly) the number of partitions times the limit rows around.
+class PhysicalPartitionedTopN : public PhysicalOperator {
+public:
+	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::PARTITIONED_TOP_N;
+
+public:
+	PhysicalPartitionedTopN(vector<LogicalType> types, unique_ptr<Expression> window_expr, idx_t limit,
+	                        idx_t estimated_cardinality);
+
+	//! The ROW_NUMBER window expression that is computed
+	unique_ptr<Expression> window_expr;
+	//! The partitions of the window followed by its orders
+	vector<BoundOrderByNode> orders;
+	//! The number of partitions at the start of the orders
+	idx_t partition_count;
+	//! The number of rows that are produced for each partition
+	idx_t limit;
+	//! The types of the input columns
+	vector<LogicalType> payload_types;
+
+public:
+	//! Returns the number of rows per partition that satisfy the filter "row_number <comparison> constant", or false
+	//! if the filter does not bound the row number from above
+	static bool GetRowNumberLimit(ExpressionType comparison, const Value &constant, idx_t &limit);
+
+public:
+	// Source interface
+	unique_ptr<GlobalSourceState> GetGlobalSourceState(ClientContext &context) const override;
+	SourceResultType GetData(ExecutionContext &context, DataChunk &chunk, OperatorSourceInput &input) const override;
+
+	bool IsSource() const override {
+		return true;
+	}
+
+public:
+	// Sink interface
+	SinkResultType Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const override;
+	SinkCombineResultType Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const override;
+	SinkFinalizeType Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+	                          OperatorSinkFinalizeInput &input) const override;
+	unique_ptr<LocalSinkState> GetLocalSinkState(ExecutionContext &context) const override;
+	unique_ptr<GlobalSinkState> GetGlobalSinkState(ClientContext &context) const override;
+
+	bool IsSink() const override {
+		return true;
+	}
+	bool ParallelSink() const override {
+		return true;
+	}
+
+	string ParamsToString() const override;
+};
+
+} // namespace duckdb
@@ -10,6 +10,7 @@
 
 #include "duckdb/execution/physical_operator.hpp"
 #include "duckdb/planner/bound_query_node.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
 
 namespace duckdb {
 
@@ -26,6 +27,8 @@ public:
 	vector<BoundOrderByNode> orders;
 	idx_t limit;
 	idx_t offset;
+	//! The filter in the scan below that is tightened with the boundary value of the first order, if any
+	shared_ptr<DynamicFilterData> dynamic_filter;
 
 public:
 	// Source interface
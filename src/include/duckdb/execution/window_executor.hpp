@@ -150,6 +150,10 @@ public:
 	virtual void Finalize() {
 	}
 
+	//! Build the shared evaluation structures. All the threads that evaluate the partition call this.
+	virtual void Build() {
+	}
+
 	virtual unique_ptr<WindowExecutorState> GetExecutorState() const;
 
 	void Evaluate(idx_t row_idx, DataChunk &input_chunk, Vector &result, WindowExecutorState &lstate) const;
@@ -185,6 +189,7 @@ public:
 
 	void Sink(DataChunk &input_chunk, const idx_t input_idx, const idx_t total_count) override;
 	void Finalize() override;
+	void Build() override;
 
 	unique_ptr<WindowExecutorState> GetExecutorState() const override;
 
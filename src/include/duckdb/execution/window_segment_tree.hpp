@@ -56,6 +56,10 @@ public:
 	//	Build
 	virtual void Sink(DataChunk &payload_chunk, SelectionVector *filter_sel, idx_t filtered);
 	virtual void Finalize(const FrameStats &stats);
+	//! Build any shared evaluation structures after Finalize.
+	//! All the threads evaluating the partition call this and can cooperate on the work.
+	virtual void Build() {
+	}
 
 	//	Probe
 	virtual unique_ptr<WindowAggregatorState> GetLocalState() const = 0;
@@ -160,13 +164,21 @@ public:
 	~WindowSegmentTree() override;
 
 	void Finalize(const FrameStats &stats) override;
+	void Build() override;
 
 	unique_ptr<WindowAggregatorState> GetLocalState() const override;
 	void Evaluate(WindowAggregatorState &lstate, const DataChunk &bounds, Vector &result, idx_t count,
 	              idx_t row_idx) const override;
 
 public:
-	void ConstructTree();
+	//! Allocate and initialise the internal nodes of the tree
+	void AllocateTree();
+	//! Claim the next range of nodes to build. Returns false if there is nothing to claim right now.
+	bool TryNextTask(idx_t &level_idx, idx_t &begin, idx_t &end);
+	//! Compute the internal nodes [begin, end) of a level from the level below
+	void ConstructNodes(WindowAggregatorState &build_state, idx_t level_idx, idx_t begin, idx_t end);
+	//! The number of nodes in a level (level 0 is the data itself)
+	idx_t LevelSize(idx_t level_idx) const;
 
 	//! Use the combine API, if available
 	inline bool UseCombineAPI() const {
@@ -184,8 +196,21 @@ public:
 	//! Use the combine API, if available
 	WindowAggregationMode mode;
 
+	//! Synchronises the claiming of nodes during a concurrent build
+	mutex build_lock;
+	//! The level currently being built
+	atomic<idx_t> build_level;
+	//! The next node of the current level to claim
+	idx_t build_started;
+	//! The number of nodes of the current level that have been built
+	atomic<idx_t> build_completed;
+	//! The states used to build the tree, which own the allocations of the internal nodes
+	vector<unique_ptr<WindowAggregatorState>> build_states;
+
 	// TREE_FANOUT needs to cleanly divide STANDARD_VECTOR_SIZE
 	static constexpr idx_t TREE_FANOUT = 16;
+	//! The number of internal nodes built by a single build task
+	static constexpr idx_t BUILD_TASK_NODES = 1024;
 };
 
 class WindowDistinctAggregator : public WindowAggregator {
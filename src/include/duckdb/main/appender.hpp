@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/common/winapi.hpp"
 #include "duckdb/main/table_description.hpp"
@@ -19,6 +20,9 @@ class ClientContext;
 class DuckDB;
 class TableCatalogEntry;
 class Connection;
+class BoundConstraint;
+class ParallelAppender;
+struct ParallelAppenderLocalState;
 
 enum class AppenderType : uint8_t {
 	LOGICAL, // Cast input -> LogicalType
@@ -140,6 +144,55 @@ protected:
 	void FlushInternal(ColumnDataCollection &collection) override;
 };
 
+//! An appender that appends to a table as part of a ParallelAppender. Each LocalAppender should only be used by a
+//! single thread, and must be destroyed before the ParallelAppender is committed or destroyed. Full row groups are
+//! written directly to storage instead of going through the transaction-local storage.
+class LocalAppender : public BaseAppender {
+	//! The parallel appender that created this appender
+	ParallelAppender &parent;
+	//! The state of the data appended by this appender - owned by the parallel appender
+	ParallelAppenderLocalState &local_state;
+
+public:
+	DUCKDB_API LocalAppender(ParallelAppender &parent, ParallelAppenderLocalState &local_state);
+	DUCKDB_API ~LocalAppender() override;
+
+protected:
+	void FlushInternal(ColumnDataCollection &collection) override;
+};
+
+//! The ParallelAppender can be used to load data into a table from multiple threads. Every thread appends through its
+//! own LocalAppender (obtained through CreateAppender), and all appended data is committed in a single transaction.
+class ParallelAppender {
+	friend class LocalAppender;
+
+public:
+	DUCKDB_API ParallelAppender(Connection &con, const string &schema_name, const string &table_name);
+	DUCKDB_API ParallelAppender(Connection &con, const string &table_name);
+	DUCKDB_API ~ParallelAppender();
+
+	//! Create a new appender that appends to the table - this can be called from multiple threads
+	DUCKDB_API unique_ptr<LocalAppender> CreateAppender();
+	//! Commit the data appended by all appenders. All appenders must have been destroyed before calling Commit.
+	DUCKDB_API void Commit();
+
+private:
+	//! A reference to a database connection that created this appender
+	shared_ptr<ClientContext> context;
+	//! The table to append to
+	optional_ptr<TableCatalogEntry> table;
+	//! The bound constraints of the table
+	vector<unique_ptr<BoundConstraint>> bound_constraints;
+	//! Lock for creating appenders and initializing their storage
+	mutex lock;
+	//! The state of every appender that was created
+	vector<unique_ptr<ParallelAppenderLocalState>> local_states;
+	//! The number of appenders that have not been destroyed yet
+	idx_t open_appenders;
+	//! Whether or not the appended data has been committed
+	bool committed;
+};
+
 template <>
 DUCKDB_API void BaseAppender::Append(bool value);
 template <>
@@ -56,6 +56,12 @@ enum class CheckpointAbort : uint8_t {
 	DEBUG_ABORT_AFTER_FREE_LIST_WRITE = 3
 };
 
+//! How commits are made durable in the write-ahead log
+//! SYNC: every commit syncs the WAL to disk before it is acknowledged
+//! GROUP: commits wait for a sync of the WAL outside of the transaction lock, so that concurrent commits share a sync
+//! ASYNC: commits are acknowledged before the WAL is synced, the WAL is synced in the background
+enum class WALCommitMode : uint8_t { SYNC = 0, GROUP = 1, ASYNC = 2 };
+
 typedef void (*set_global_function_t)(DatabaseInstance *db, DBConfig &config, const Value &parameter);
 typedef void (*set_local_function_t)(ClientContext &context, const Value &parameter);
 typedef void (*reset_global_function_t)(DatabaseInstance *db, DBConfig &config);
@@ -98,6 +104,10 @@ struct DBConfigOptions {
 	AccessMode access_mode = AccessMode::AUTOMATIC;
 	//! Checkpoint when WAL reaches this size (default: 16MB)
 	idx_t checkpoint_wal_size = 1 << 24;
+	//! How commits are made durable in the WAL (SYNC, GROUP or ASYNC)
+	WALCommitMode wal_commit_mode = WALCommitMode::SYNC;
+	//! The maximum time (in milliseconds) committed changes can remain unsynced in ASYNC commit mode
+	idx_t wal_async_commit_interval = 100;
 	//! Whether or not to use Direct IO, bypassing operating system buffers
 	bool use_direct_io = false;
 	//! Whether extensions should be loaded on start-up
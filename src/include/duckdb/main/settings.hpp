@@ -671,4 +671,25 @@ struct CustomUserAgentSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct WALCommitModeSetting {
+	static constexpr const char *Name = "wal_commit_mode";
+	static constexpr const char *Description =
+	    "How commits are made durable in the WAL: sync every commit (sync), share syncs between concurrent commits "
+	    "(group) or sync in the background (async)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct WALAsyncCommitIntervalSetting {
+	static constexpr const char *Name = "wal_async_commit_interval";
+	static constexpr const char *Description =
+	    "The maximum time in milliseconds that committed changes remain unsynced in the async WAL commit mode";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 } // namespace duckdb
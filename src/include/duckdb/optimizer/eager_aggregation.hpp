@@ -0,0 +1,47 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/optimizer/eager_aggregation.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/column_binding_map.hpp"
+#include "duckdb/planner/logical_operator.hpp"
+
+namespace duckdb {
+class LogicalAggregate;
+class LogicalComparisonJoin;
+class Optimizer;
+
+//! The EagerAggregation optimizer pushes a partial aggregate below an inner join. This is done when all aggregates
+//! on top of the join are decomposable and only reference one side of the join, and when the statistics predict that
+//! grouping that side on its join keys substantially reduces the number of rows that flow into the join, e.g.:
+//! SELECT d.region, SUM(f.amount) FROM fact f JOIN dim d USING (k) GROUP BY d.region
+//! is rewritten to join dim with (SELECT k, SUM(amount) FROM fact GROUP BY k), and to sum up the partial sums
+class EagerAggregation {
+public:
+	//! The minimum factor by which the partial aggregate must reduce the row count of the pre-aggregated side
+	static constexpr const idx_t MINIMUM_REDUCTION_FACTOR = 4;
+
+public:
+	explicit EagerAggregation(Optimizer &optimizer);
+
+	unique_ptr<LogicalOperator> Optimize(unique_ptr<LogicalOperator> op);
+
+private:
+	void OptimizeInternal(unique_ptr<LogicalOperator> &op);
+	//! Try to push a partial aggregate into the given side of the join below the aggregate
+	bool TryPushAggregate(unique_ptr<LogicalOperator> &op, idx_t side);
+	//! Estimate the number of groups when grouping the given operator on the given columns
+	bool EstimateGroupCount(LogicalOperator &op, const vector<ColumnBinding> &groups, idx_t &result);
+
+private:
+	Optimizer &optimizer;
+	//! The root of the plan, used to replace the bindings of the aggregate if a projection is added above it
+	optional_ptr<LogicalOperator> root;
+};
+
+} // namespace duckdb
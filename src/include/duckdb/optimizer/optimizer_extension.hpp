@@ -9,10 +9,13 @@
 #pragma once
 
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/optional_ptr.hpp"
 #include "duckdb/planner/logical_operator.hpp"
 
 namespace duckdb {
 
+class Optimizer;
+
 //! The OptimizerExtensionInfo holds static information relevant to the optimizer extension
 struct OptimizerExtensionInfo {
 	virtual ~OptimizerExtensionInfo() {
@@ -22,11 +25,23 @@ struct OptimizerExtensionInfo {
 typedef void (*optimize_function_t)(ClientContext &context, OptimizerExtensionInfo *info,
                                     unique_ptr<LogicalOperator> &plan);
 
+//! The input of a pre-optimize function, which gives access to the optimizer (and its binder) that runs it
+struct OptimizerExtensionInput {
+	ClientContext &context;
+	Optimizer &optimizer;
+	optional_ptr<OptimizerExtensionInfo> info;
+};
+
+typedef void (*pre_optimize_function_t)(OptimizerExtensionInput &input, unique_ptr<LogicalOperator> &plan);
+
 class OptimizerExtension {
 public:
 	//! The parse function of the parser extension.
 	//! Takes a query string as input and returns ParserExtensionParseData (on success) or an error
-	optimize_function_t optimize_function;
+	optimize_function_t optimize_function = nullptr;
+	//! Optional function that is called before the built-in optimizers run, i.e. before filters and projections are
+	//! pushed down
+	pre_optimize_function_t pre_optimize_function = nullptr;
 
 	//! Additional parser info passed to the parse function
 	shared_ptr<OptimizerExtensionInfo> optimizer_info;
@@ -12,6 +12,7 @@
 
 namespace duckdb {
 class LogicalOperator;
+class LogicalTopN;
 class Optimizer;
 
 class TopN {
@@ -20,6 +21,11 @@ public:
 	unique_ptr<LogicalOperator> Optimize(unique_ptr<LogicalOperator> op);
 	//! Whether we can perform the optimization on this operator
 	static bool CanOptimize(LogicalOperator &op);
+
+private:
+	//! Push a filter on the first order column into the scan below the top-n, which is tightened with the boundary
+	//! value of the heap while the query runs
+	static void PushdownDynamicFilters(LogicalTopN &op);
 };
 
 } // namespace duckdb
@@ -0,0 +1,76 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/dynamic_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/table_filter.hpp"
+
+namespace duckdb {
+
+//! A copy of the filter of a DynamicFilterData that is held by a single scan, and is only refreshed when the filter
+//! has changed since the copy was taken
+struct DynamicFilterSnapshot {
+	//! The version of the filter at which the copy was taken
+	idx_t version = 0;
+	shared_ptr<ConstantFilter> filter;
+};
+
+//! DynamicFilterData holds a comparison against a constant that is only known while the query runs, e.g. the
+//! boundary value of a top-n heap. Until a constant is set, the filter lets everything through.
+class DynamicFilterData {
+public:
+	explicit DynamicFilterData(ExpressionType comparison_type);
+
+	//! Sets the constant of the filter, unless the current constant is already more selective
+	void Tighten(const Value &constant);
+	//! Clears the constant of the filter
+	void Reset();
+	//! Returns the current filter, or nullptr if no constant has been set
+	shared_ptr<ConstantFilter> GetFilter();
+	//! Returns the filter of the snapshot, after refreshing the snapshot if the filter has changed since it was taken.
+	//! Unless the filter has changed, this does not take the lock.
+	optional_ptr<ConstantFilter> GetFilter(DynamicFilterSnapshot &snapshot);
+
+private:
+	mutex lock;
+	//! The comparison type of the filter (one of <, <=, >, >=)
+	ExpressionType comparison_type;
+	//! The current filter. A filter is never modified once it is set, it is replaced when the constant changes.
+	shared_ptr<ConstantFilter> filter;
+	//! Incremented (while holding the lock) whenever the filter changes
+	atomic<idx_t> version;
+};
+
+class DynamicFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::DYNAMIC_FILTER;
+
+public:
+	DynamicFilter();
+	explicit DynamicFilter(shared_ptr<DynamicFilterData> filter_data);
+
+	//! The shared state of the filter, which is updated while the query runs
+	shared_ptr<DynamicFilterData> filter_data;
+
+public:
+	//! Returns the current filter, or nullptr if the filter lets everything through
+	shared_ptr<ConstantFilter> GetFilter() const;
+	//! Returns the current filter through a snapshot of the scan, or nullptr if the filter lets everything through
+	optional_ptr<ConstantFilter> GetFilter(DynamicFilterSnapshot &snapshot) const;
+
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	bool Equals(const TableFilter &other) const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
+};
+
+} // namespace duckdb
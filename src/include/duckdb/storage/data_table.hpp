@@ -138,6 +138,9 @@ public:
 
 	//! Fetches an append lock
 	void AppendLock(TableAppendState &state);
+	//! Fetches the commit lock. A committing transaction holds this lock from the moment it starts flushing its
+	//! transaction-local storage into the table until its commit (or rollback) is finished
+	unique_lock<mutex> CommitLock();
 	//! Begin appending structs to this table, obtaining necessary locks, etc
 	void InitializeAppend(DuckTransaction &transaction, TableAppendState &state);
 	//! Append a chunk to the table using the AppendState obtained from InitializeAppend
@@ -178,6 +181,8 @@ public:
 
 	//! Get statistics of a physical column within the table
 	unique_ptr<BaseStatistics> GetStatistics(ClientContext &context, column_t column_id);
+	//! Whether or not the statistics of the row groups show that they are ordered on a physical column
+	bool RowGroupsOrderedOn(column_t column_id);
 	//! Sets statistics of a physical column within the table
 	void SetDistinct(column_t column_id, unique_ptr<DistinctStatistics> distinct_stats);
 
@@ -230,6 +235,8 @@ private:
 private:
 	//! Lock for appending entries to the table
 	mutex append_lock;
+	//! Lock for committing transaction-local storage to the table
+	mutex commit_lock;
 	//! The row groups of the table
 	shared_ptr<RowGroupCollection> row_groups;
 	//! Whether or not the data table is the root DataTable for this table; the root DataTable is the newest version
@@ -55,6 +55,8 @@ public:
 
 	//! Get the WAL of the StorageManager, returns nullptr if in-memory
 	optional_ptr<WriteAheadLog> GetWriteAheadLog();
+	//! Get a reference to the WAL of the StorageManager that keeps it alive, returns nullptr if in-memory
+	shared_ptr<WriteAheadLog> GetSharedWriteAheadLog();
 
 	//! Returns the database file path
 	string GetDBPath() {
@@ -81,7 +83,7 @@ protected:
 	//! The path of the database
 	string path;
 	//! The WriteAheadLog of the storage manager
-	unique_ptr<WriteAheadLog> wal;
+	shared_ptr<WriteAheadLog> wal;
 	//! Whether or not the database is opened in read-only mode
 	bool read_only;
 	//! When loading a database, we do not yet set the wal-field. Therefore, GetWriteAheadLog must
@@ -162,6 +162,9 @@ protected:
 	idx_t ScanVector(TransactionData transaction, idx_t vector_index, ColumnScanState &state, Vector &result);
 
 	void ClearUpdates();
+	//! Whether or not all rows of the given vector have been updated, in which case the base data does not need to be
+	//! scanned
+	bool HasFullUpdates(idx_t vector_index, idx_t scan_count) const;
 	void FetchUpdates(TransactionData transaction, idx_t vector_index, Vector &result, idx_t scan_count,
 	                  bool allow_updates, bool scan_committed);
 	void FetchUpdateRow(TransactionData transaction, row_t row_id, Vector &result, idx_t result_idx);
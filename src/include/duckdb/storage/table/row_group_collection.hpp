@@ -109,6 +109,10 @@ public:
 
 	void CopyStats(TableStatistics &stats);
 	unique_ptr<BaseStatistics> CopyStats(column_t column_id);
+	//! Whether or not the statistics of the row groups show that they are ordered on a column, i.e. no row group
+	//! contains a value that is smaller than the maximum value of a row group before it. The result is cached until
+	//! the number of rows in the collection changes, so it can be out of date after updates.
+	bool RowGroupsOrderedOn(column_t column_id);
 	void SetDistinct(column_t column_id, unique_ptr<DistinctStatistics> distinct_stats);
 
 	AttachedDatabase &GetAttached();
@@ -143,6 +147,10 @@ private:
 	TableStatistics stats;
 	//! Allocation size, only tracked for appends
 	idx_t allocation_size;
+	//! The lock for the cached results of RowGroupsOrderedOn
+	mutex ordered_lock;
+	//! The cached results of RowGroupsOrderedOn, and the number of rows they were computed for
+	unordered_map<column_t, pair<idx_t, bool>> ordered_columns;
 };
 
 } // namespace duckdb
@@ -13,6 +13,7 @@
 #include "duckdb/storage/storage_lock.hpp"
 #include "duckdb/common/enums/scan_options.hpp"
 #include "duckdb/execution/adaptive_filter.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
 #include "duckdb/storage/table/segment_lock.hpp"
 
 namespace duckdb {
@@ -91,6 +92,8 @@ struct ColumnScanState {
 	idx_t last_offset = 0;
 	//! Contains TableScan level config for scanning
 	optional_ptr<TableScanOptions> scan_options;
+	//! The snapshot of the dynamic filter on this column (if any)
+	DynamicFilterSnapshot dynamic_filter;
 
 public:
 	void Initialize(const LogicalType &type, optional_ptr<TableScanOptions> options);
@@ -32,6 +32,9 @@ public:
 	bool HasUncommittedUpdates(idx_t vector_index);
 	bool HasUpdates(idx_t vector_index) const;
 	bool HasUpdates(idx_t start_row_idx, idx_t end_row_idx);
+	//! Whether or not the first "count" rows of the vector have all been updated, i.e. the base data of the vector is
+	//! never visible to any transaction
+	bool HasFullUpdates(idx_t vector_index, idx_t count);
 
 	void FetchUpdates(TransactionData transaction, idx_t vector_index, Vector &result);
 	void FetchCommitted(idx_t vector_index, Vector &result);
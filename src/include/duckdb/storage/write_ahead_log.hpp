@@ -14,12 +14,16 @@
 #include "duckdb/catalog/catalog_entry/table_macro_catalog_entry.hpp"
 #include "duckdb/common/enums/wal_type.hpp"
 #include "duckdb/common/helper.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/common/serializer/buffered_file_writer.hpp"
+#include "duckdb/common/thread.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/storage/block.hpp"
 #include "duckdb/storage/storage_info.hpp"
 
+#include <condition_variable>
+
 namespace duckdb {
 
 struct AlterInfo;
@@ -110,14 +114,43 @@ public:
 	void Truncate(int64_t size);
 	//! Delete the WAL file on disk. The WAL should not be used after this point.
 	void Delete();
+	//! Flush all changes made to the WAL and sync them to disk
 	void Flush();
+	//! Flush the changes made by a commit to the WAL. Depending on the WAL commit mode, the changes are either synced
+	//! immediately (SYNC), synced by the committer in SyncCommits after releasing the transaction lock (GROUP) or
+	//! synced by a background thread (ASYNC)
+	void FlushCommit();
+	//! Wait until all commits flushed to the WAL so far have been synced to disk - concurrent callers share a sync
+	void SyncCommits();
 
 	void WriteCheckpoint(MetaBlockPointer meta_block);
 
+protected:
+	//! Sync the WAL until at least "target" commits are synced, or wait for another thread that is doing so
+	void SyncInternal(unique_lock<mutex> &guard, idx_t target);
+	//! Background thread that syncs the WAL in ASYNC commit mode
+	void SyncThreadLoop();
+	void StopSyncThread();
+
 protected:
 	AttachedDatabase &database;
 	unique_ptr<BufferedFileWriter> writer;
 	string wal_path;
+
+	//! Protects the commit sync state below
+	mutex sync_lock;
+	std::condition_variable sync_cv;
+	//! The number of commits that were flushed to the WAL
+	idx_t flushed_commits;
+	//! The number of commits that were synced to disk
+	idx_t synced_commits;
+	//! Whether or not a thread is currently syncing the WAL
+	bool sync_in_progress;
+	//! Whether or not a sync has failed, after which the WAL can no longer be synced
+	bool sync_failed;
+	//! Whether or not the background sync thread should stop
+	bool stop_sync_thread;
+	unique_ptr<thread> sync_thread;
 };
 
 } // namespace duckdb
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/transaction/transaction.hpp"
+#include "duckdb/transaction/local_storage.hpp"
 
 namespace duckdb {
 class RowVersionManager;
@@ -37,6 +38,10 @@ public:
 
 	void PushCatalogEntry(CatalogEntry &entry, data_ptr_t extra_data = nullptr, idx_t extra_data_size = 0);
 
+	//! Flush the transaction-local storage into the base tables. This happens before a commit identifier is assigned:
+	//! the flushed rows are not visible to other transactions until the commit has finished. The commit locks of the
+	//! flushed tables are stored in the commit state, and must be held until the commit (or rollback) is finished.
+	ErrorData FlushLocalStorage(LocalStorage::CommitState &commit_state) noexcept;
 	//! Commit the current transaction with the given commit identifier. Returns an error message if the transaction
 	//! commit failed, or an empty string if the commit was sucessful
 	ErrorData Commit(AttachedDatabase &db, transaction_t commit_id, bool checkpoint) noexcept;
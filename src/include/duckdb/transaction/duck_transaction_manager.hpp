@@ -12,6 +12,7 @@
 
 namespace duckdb {
 class DuckTransaction;
+class WriteAheadLog;
 
 //! The Transaction Manager is responsible for creating and managing
 //! transactions
@@ -73,6 +74,9 @@ private:
 	vector<unique_ptr<DuckTransaction>> old_transactions;
 	//! The lock used for transaction operations
 	mutex transaction_lock;
+	//! The WAL that commits are synced to after releasing the transaction lock in GROUP commit mode. New transactions
+	//! wait for this sync before they start, so that such commits are only published once they are durable
+	shared_ptr<WriteAheadLog> group_commit_log;
 
 	bool thread_is_checkpointing;
 
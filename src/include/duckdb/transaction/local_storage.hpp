@@ -96,6 +96,8 @@ public:
 		~CommitState();
 
 		reference_map_t<DataTable, unique_ptr<TableAppendState>> append_states;
+		//! The commit locks of the tables the local storage has been flushed to
+		vector<unique_lock<mutex>> commit_locks;
 	};
 
 public:
@@ -10,6 +10,7 @@
 
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/enums/undo_flags.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/storage/arena_allocator.hpp"
 
 namespace duckdb {
@@ -31,7 +32,8 @@ public:
 	explicit UndoBuffer(ClientContext &context);
 
 	//! Reserve space for an entry of the specified type and length in the undo
-	//! buffer
+	//! buffer. This method is thread-safe, as entries can be created by multiple threads within the same transaction
+	//! (e.g. in a parallel DELETE or UPDATE)
 	data_ptr_t CreateEntry(UndoFlags type, idx_t len);
 
 	bool ChangesMade();
@@ -49,6 +51,8 @@ public:
 
 private:
 	ArenaAllocator allocator;
+	//! The lock used to create new entries in the undo buffer
+	mutex entry_lock;
 
 private:
 	template <class T>
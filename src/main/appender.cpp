@@ -11,7 +11,13 @@
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/connection.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/planner/binder.hpp"
 #include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/optimistic_data_writer.hpp"
+#include "duckdb/storage/table/append_state.hpp"
+#include "duckdb/storage/table/row_group_collection.hpp"
+#include "duckdb/storage/table_io_manager.hpp"
+#include "duckdb/transaction/duck_transaction.hpp"
 
 namespace duckdb {
 
@@ -387,4 +393,154 @@ void BaseAppender::Close() {
 	}
 }
 
+//===--------------------------------------------------------------------===//
+// Parallel Appender
+//===--------------------------------------------------------------------===//
+struct ParallelAppenderLocalState {
+	//! The row groups appended by the appender
+	unique_ptr<RowGroupCollection> collection;
+	TableAppendState append_state;
+	//! The writer used to write full row groups to disk
+	optional_ptr<OptimisticDataWriter> writer;
+	unique_ptr<ConstraintState> constraint_state;
+	//! Whether or not an append has failed
+	bool has_error = false;
+};
+
+LocalAppender::LocalAppender(ParallelAppender &parent_p, ParallelAppenderLocalState &local_state_p)
+    : BaseAppender(Allocator::DefaultAllocator(), parent_p.table->GetTypes(), AppenderType::LOGICAL), parent(parent_p),
+      local_state(local_state_p) {
+}
+
+LocalAppender::~LocalAppender() {
+	Destructor();
+	lock_guard<mutex> guard(parent.lock);
+	parent.open_appenders--;
+}
+
+void LocalAppender::FlushInternal(ColumnDataCollection &collection) {
+	auto &context = *parent.context;
+	auto &table = *parent.table;
+	auto &storage = table.GetStorage();
+	if (local_state.has_error) {
+		throw InvalidInputException("Failed to append: a previous append to this appender failed");
+	}
+	if (!local_state.collection) {
+		lock_guard<mutex> guard(parent.lock);
+		auto &block_manager = TableIOManager::Get(storage).GetBlockManagerForRowData();
+		auto types = table.GetTypes();
+		local_state.collection =
+		    make_uniq<RowGroupCollection>(storage.info, block_manager, types, NumericCast<idx_t>(MAX_ROW_ID));
+		local_state.collection->InitializeEmpty();
+		local_state.collection->InitializeAppend(local_state.append_state);
+		local_state.writer = &storage.CreateOptimisticWriter(context);
+		local_state.constraint_state = storage.InitializeConstraintState(table, parent.bound_constraints);
+	}
+	try {
+		for (auto &chunk : collection.Chunks()) {
+			storage.VerifyAppendConstraints(*local_state.constraint_state, context, chunk);
+			auto new_row_group = local_state.collection->Append(chunk, local_state.append_state);
+			if (new_row_group) {
+				local_state.writer->WriteNewRowGroup(*local_state.collection);
+			}
+		}
+	} catch (...) {
+		local_state.has_error = true;
+		throw;
+	}
+}
+
+ParallelAppender::ParallelAppender(Connection &con, const string &schema_name, const string &table_name)
+    : context(con.context), open_appenders(0), committed(false) {
+	con.BeginTransaction();
+	try {
+		context->RunFunctionInTransaction([&]() {
+			auto &table_entry =
+			    Catalog::GetEntry<TableCatalogEntry>(*context, INVALID_CATALOG, schema_name, table_name);
+			if (!table_entry.IsDuckTable()) {
+				throw InvalidInputException("Parallel appends are only supported for DuckDB tables");
+			}
+			auto binder = Binder::CreateBinder(*context);
+			bound_constraints = binder->BindConstraints(table_entry);
+			table = &table_entry;
+		});
+	} catch (...) {
+		con.Rollback();
+		throw;
+	}
+}
+
+ParallelAppender::ParallelAppender(Connection &con, const string &table_name)
+    : ParallelAppender(con, DEFAULT_SCHEMA, table_name) {
+}
+
+ParallelAppender::~ParallelAppender() {
+	if (committed) {
+		return;
+	}
+	// the appended data was never committed - roll back the transaction
+	try {
+		context->Query("ROLLBACK", false);
+	} catch (...) { // NOLINT
+	}
+}
+
+unique_ptr<LocalAppender> ParallelAppender::CreateAppender() {
+	lock_guard<mutex> guard(lock);
+	if (committed) {
+		throw InvalidInputException("Failed to create appender: the parallel appender has already been committed");
+	}
+	local_states.push_back(make_uniq<ParallelAppenderLocalState>());
+	open_appenders++;
+	return make_uniq<LocalAppender>(*this, *local_states.back());
+}
+
+void ParallelAppender::Commit() {
+	lock_guard<mutex> guard(lock);
+	if (committed) {
+		throw InvalidInputException("Failed to commit: the parallel appender has already been committed");
+	}
+	if (open_appenders > 0) {
+		// the local appenders might still hold rows that have not been flushed, and they reference their local state
+		throw InvalidInputException("Failed to commit: all appenders must be destroyed before committing");
+	}
+	for (auto &local_state : local_states) {
+		if (local_state->has_error) {
+			throw InvalidInputException("Failed to commit: an append to one of the appenders failed");
+		}
+	}
+	context->RunFunctionInTransaction([&]() {
+		auto &storage = table->GetStorage();
+		auto &transaction = DuckTransaction::Get(*context, table->catalog);
+		for (auto &local_state : local_states) {
+			auto &collection = local_state->collection;
+			if (!collection) {
+				continue;
+			}
+			TransactionData tdata(0, 0);
+			collection->FinalizeAppend(tdata, local_state->append_state);
+			if (collection->GetTotalRows() < Storage::ROW_GROUP_SIZE) {
+				// we have few rows - append to the local storage directly
+				LocalAppendState append_state;
+				storage.InitializeLocalAppend(append_state, *table, *context, bound_constraints);
+				collection->Scan(transaction, [&](DataChunk &chunk) {
+					storage.LocalAppend(append_state, *table, *context, chunk, true);
+					return true;
+				});
+				storage.FinalizeLocalAppend(append_state);
+			} else {
+				// we have written rows to disk optimistically - merge directly into the transaction-local storage
+				storage.LocalMerge(*context, *collection);
+				storage.FinalizeOptimisticWriter(*context, *local_state->writer);
+			}
+		}
+	});
+	local_states.clear();
+	auto result = context->Query("COMMIT", false);
+	committed = true;
+	if (result->HasError()) {
+		result->ThrowError();
+	}
+}
+
 } // namespace duckdb
@@ -85,6 +85,7 @@ bool QueryProfiler::OperatorRequiresProfiling(PhysicalOperatorType op_type) {
 	case PhysicalOperatorType::LIMIT_PERCENT:
 	case PhysicalOperatorType::STREAMING_LIMIT:
 	case PhysicalOperatorType::TOP_N:
+	case PhysicalOperatorType::PARTITIONED_TOP_N:
 	case PhysicalOperatorType::WINDOW:
 	case PhysicalOperatorType::UNNEST:
 	case PhysicalOperatorType::UNGROUPED_AGGREGATE:
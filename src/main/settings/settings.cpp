@@ -1449,4 +1449,58 @@ Value CustomUserAgentSetting::GetSetting(const ClientContext &context) {
 	return Value(config.options.custom_user_agent);
 }
 
+//===--------------------------------------------------------------------===//
+// WAL Commit Mode
+//===--------------------------------------------------------------------===//
+void WALCommitModeSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto parameter = StringUtil::Lower(input.ToString());
+	if (parameter == "sync") {
+		config.options.wal_commit_mode = WALCommitMode::SYNC;
+	} else if (parameter == "group") {
+		config.options.wal_commit_mode = WALCommitMode::GROUP;
+	} else if (parameter == "async") {
+		config.options.wal_commit_mode = WALCommitMode::ASYNC;
+	} else {
+		throw InvalidInputException("Unrecognized option for wal_commit_mode, expected sync, group or async");
+	}
+}
+
+void WALCommitModeSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.wal_commit_mode = DBConfig().options.wal_commit_mode;
+}
+
+Value WALCommitModeSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	switch (config.options.wal_commit_mode) {
+	case WALCommitMode::SYNC:
+		return "sync";
+	case WALCommitMode::GROUP:
+		return "group";
+	case WALCommitMode::ASYNC:
+		return "async";
+	default:
+		throw InternalException("Unrecognized WAL commit mode");
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// WAL Async Commit Interval
+//===--------------------------------------------------------------------===//
+void WALAsyncCommitIntervalSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto interval = input.GetValue<uint64_t>();
+	if (interval == 0) {
+		throw InvalidInputException("wal_async_commit_interval must be at least 1 millisecond");
+	}
+	config.options.wal_async_commit_interval = interval;
+}
+
+void WALAsyncCommitIntervalSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.wal_async_commit_interval = DBConfig().options.wal_async_commit_interval;
+}
+
+Value WALAsyncCommitIntervalSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::UBIGINT(config.options.wal_async_commit_interval);
+}
+
 } // namespace duckdb
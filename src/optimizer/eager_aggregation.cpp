@@ -0,0 +1,279 @@
+#include "duckdb/optimizer/eager_aggregation.hpp"
+
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/catalog/catalog_entry/aggregate_function_catalog_entry.hpp"
+#include "duckdb/function/function_binder.hpp"
+#include "duckdb/optimizer/column_binding_replacer.hpp"
+#include "duckdb/optimizer/join_order/relation_statistics_helper.hpp"
+#include "duckdb/optimizer/optimizer.hpp"
+#include "duckdb/planner/binder.hpp"
+#include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_cast_expression.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/operator/logical_aggregate.hpp"
+#include "duckdb/planner/operator/logical_comparison_join.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
+
+namespace duckdb {
+
+EagerAggregation::EagerAggregation(Optimizer &optimizer) : optimizer(optimizer) {
+}
+
+unique_ptr<LogicalOperator> EagerAggregation::Optimize(unique_ptr<LogicalOperator> op) {
+	root = op.get();
+	OptimizeInternal(op);
+	return op;
+}
+
+void EagerAggregation::OptimizeInternal(unique_ptr<LogicalOperator> &op) {
+	for (auto &child : op->children) {
+		OptimizeInternal(child);
+	}
+	if (op->type != LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY) {
+		return;
+	}
+	auto &aggr = op->Cast<LogicalAggregate>();
+	if (aggr.grouping_sets.size() > 1 || !aggr.grouping_functions.empty()) {
+		return;
+	}
+	if (aggr.children[0]->type != LogicalOperatorType::LOGICAL_COMPARISON_JOIN) {
+		return;
+	}
+	auto &join = aggr.children[0]->Cast<LogicalComparisonJoin>();
+	if (join.join_type != JoinType::INNER || !join.duplicate_eliminated_columns.empty() ||
+	    !join.left_projection_map.empty() || !join.right_projection_map.empty()) {
+		return;
+	}
+	// prefer pre-aggregating the probe side of the join
+	if (!TryPushAggregate(op, 0)) {
+		TryPushAggregate(op, 1);
+	}
+}
+
+static bool IsDecomposableAggregate(const BoundAggregateExpression &aggregate) {
+	if (aggregate.IsDistinct() || aggregate.filter || aggregate.order_bys) {
+		return false;
+	}
+	auto &name = aggregate.function.name;
+	return name == "sum" || name == "min" || name == "max" || name == "count" || name == "count_star";
+}
+
+static optional_ptr<LogicalGet> FindGet(LogicalOperator &op, idx_t table_index) {
+	if (op.type == LogicalOperatorType::LOGICAL_GET) {
+		auto &get = op.Cast<LogicalGet>();
+		if (get.table_index == table_index) {
+			return &get;
+		}
+	}
+	for (auto &child : op.children) {
+		auto result = FindGet(*child, table_index);
+		if (result) {
+			return result;
+		}
+	}
+	return nullptr;
+}
+
+bool EagerAggregation::EstimateGroupCount(LogicalOperator &op, const vector<ColumnBinding> &groups, idx_t &result) {
+	// the number of groups is bounded by the product of the distinct counts of the grouped columns
+	// we only use distinct counts from base table statistics: grouping columns that are computed are not supported
+	double group_count = 1;
+	for (auto &binding : groups) {
+		auto get = FindGet(op, binding.table_index);
+		if (!get) {
+			return false;
+		}
+		auto stats = RelationStatisticsHelper::ExtractGetStats(*get, optimizer.context);
+		if (binding.column_index >= stats.column_distinct_count.size()) {
+			return false;
+		}
+		auto &distinct_count = stats.column_distinct_count[binding.column_index];
+		if (!distinct_count.from_hll) {
+			return false;
+		}
+		group_count *= static_cast<double>(distinct_count.distinct_count);
+	}
+	auto cardinality =
+	    op.has_estimated_cardinality ? op.estimated_cardinality : op.EstimateCardinality(optimizer.context);
+	if (group_count * static_cast<double>(MINIMUM_REDUCTION_FACTOR) > static_cast<double>(cardinality)) {
+		// the partial aggregate does not reduce the cardinality enough
+		return false;
+	}
+	result = static_cast<idx_t>(group_count);
+	return true;
+}
+
+bool EagerAggregation::TryPushAggregate(unique_ptr<LogicalOperator> &op, idx_t side) {
+	auto &context = optimizer.context;
+	auto &aggr = op->Cast<LogicalAggregate>();
+	auto &join = aggr.children[0]->Cast<LogicalComparisonJoin>();
+	auto &child = join.children[side];
+
+	// gather the types of the columns produced by the side of the join we want to pre-aggregate
+	child->ResolveOperatorTypes();
+	auto child_bindings = child->GetColumnBindings();
+	column_binding_map_t<LogicalType> child_types;
+	for (idx_t i = 0; i < child_bindings.size(); i++) {
+		child_types[child_bindings[i]] = child->types[i];
+	}
+	auto is_child_column = [&](const Expression &expr) {
+		if (expr.type != ExpressionType::BOUND_COLUMN_REF) {
+			return false;
+		}
+		return child_types.find(expr.Cast<BoundColumnRefExpression>().binding) != child_types.end();
+	};
+
+	// the partial aggregate groups on the join keys and on the groups of the aggregate that come from this side
+	vector<ColumnBinding> partial_groups;
+	column_binding_map_t<idx_t> partial_group_map;
+	auto add_group = [&](const Expression &expr) {
+		auto &binding = expr.Cast<BoundColumnRefExpression>().binding;
+		if (partial_group_map.find(binding) == partial_group_map.end()) {
+			partial_group_map[binding] = partial_groups.size();
+			partial_groups.push_back(binding);
+		}
+	};
+	for (auto &condition : join.conditions) {
+		auto &expr = side == 0 ? *condition.left : *condition.right;
+		if (!is_child_column(expr)) {
+			return false;
+		}
+		add_group(expr);
+	}
+	for (auto &group : aggr.groups) {
+		if (group->type != ExpressionType::BOUND_COLUMN_REF) {
+			return false;
+		}
+		if (is_child_column(*group)) {
+			add_group(*group);
+		}
+	}
+	// all aggregates must be decomposable and can only reference this side of the join
+	for (auto &expr : aggr.expressions) {
+		if (expr->GetExpressionClass() != ExpressionClass::BOUND_AGGREGATE) {
+			return false;
+		}
+		auto &aggregate = expr->Cast<BoundAggregateExpression>();
+		if (!IsDecomposableAggregate(aggregate)) {
+			return false;
+		}
+		auto &name = aggregate.function.name;
+		if (aggr.groups.empty() && (name == "count" || name == "count_star")) {
+			// without groups the aggregate produces a row even if the join is empty
+			// COUNT must return 0 for that row, but the SUM of the partial counts would be NULL
+			return false;
+		}
+		for (auto &aggregate_child : aggregate.children) {
+			if (!is_child_column(*aggregate_child)) {
+				return false;
+			}
+		}
+	}
+	if (partial_groups.empty()) {
+		return false;
+	}
+	idx_t group_count;
+	if (!EstimateGroupCount(*child, partial_groups, group_count)) {
+		return false;
+	}
+
+	// bind the final aggregates, which combine the results of the partial aggregates
+	auto partial_group_index = optimizer.binder.GenerateTableIndex();
+	auto partial_aggregate_index = optimizer.binder.GenerateTableIndex();
+	FunctionBinder function_binder(context);
+	vector<unique_ptr<Expression>> final_aggregates;
+	vector<LogicalType> aggregate_types;
+	bool requires_cast = false;
+	for (idx_t i = 0; i < aggr.expressions.size(); i++) {
+		auto &aggregate = aggr.expressions[i]->Cast<BoundAggregateExpression>();
+		aggregate_types.push_back(aggregate.return_type);
+		auto &name = aggregate.function.name;
+		// counts are combined by summing them up
+		auto final_name = name == "count" || name == "count_star" ? "sum" : name;
+		auto &func = Catalog::GetEntry<AggregateFunctionCatalogEntry>(context, SYSTEM_CATALOG, DEFAULT_SCHEMA,
+		                                                              final_name);
+		vector<LogicalType> arguments {aggregate.return_type};
+		ErrorData error;
+		auto best_function = function_binder.BindFunction(func.name, func.functions, arguments, error);
+		if (!best_function.IsValid()) {
+			return false;
+		}
+		vector<unique_ptr<Expression>> children;
+		children.push_back(
+		    make_uniq<BoundColumnRefExpression>(aggregate.return_type, ColumnBinding(partial_aggregate_index, i)));
+		auto final_aggregate =
+		    function_binder.BindAggregateFunction(func.functions.GetFunctionByOffset(best_function.GetIndex()),
+		                                          std::move(children), nullptr, AggregateType::NON_DISTINCT);
+		if (final_aggregate->return_type != aggregate.return_type) {
+			if (final_name == name) {
+				return false;
+			}
+			// the sum of the counts is a HUGEINT - we cast it back to a BIGINT in a projection on top of the aggregate
+			requires_cast = true;
+		}
+		final_aggregates.push_back(std::move(final_aggregate));
+	}
+
+	// create the partial aggregate and push it into the join
+	auto partial_aggregate =
+	    make_uniq<LogicalAggregate>(partial_group_index, partial_aggregate_index, std::move(aggr.expressions));
+	for (auto &binding : partial_groups) {
+		partial_aggregate->groups.push_back(make_uniq<BoundColumnRefExpression>(child_types[binding], binding));
+	}
+	partial_aggregate->children.push_back(std::move(child));
+	partial_aggregate->ResolveOperatorTypes();
+	partial_aggregate->estimated_cardinality = group_count;
+	partial_aggregate->has_estimated_cardinality = true;
+	child = std::move(partial_aggregate);
+	aggr.expressions = std::move(final_aggregates);
+
+	// the join conditions and the groups of the aggregate now reference the groups of the partial aggregate
+	ColumnBindingReplacer replacer;
+	for (idx_t i = 0; i < partial_groups.size(); i++) {
+		replacer.replacement_bindings.emplace_back(partial_groups[i], ColumnBinding(partial_group_index, i));
+	}
+	replacer.stop_operator = child.get();
+	replacer.VisitOperator(*op);
+
+	if (!requires_cast) {
+		return true;
+	}
+	// add a projection that casts the summed counts back to their original type
+	op->ResolveOperatorTypes();
+	auto bindings = op->GetColumnBindings();
+	vector<LogicalType> projection_types;
+	vector<unique_ptr<Expression>> projections;
+	for (idx_t i = 0; i < bindings.size(); i++) {
+		auto &type = op->types[i];
+		auto &original_type = i < aggr.groups.size() ? type : aggregate_types[i - aggr.groups.size()];
+		unique_ptr<Expression> expr = make_uniq<BoundColumnRefExpression>(type, bindings[i]);
+		if (type != original_type) {
+			expr = BoundCastExpression::AddCastToType(context, std::move(expr), original_type);
+		}
+		projection_types.push_back(original_type);
+		projections.push_back(std::move(expr));
+	}
+	auto projection_index = optimizer.binder.GenerateTableIndex();
+	auto projection = make_uniq<LogicalProjection>(projection_index, std::move(projections));
+	projection->estimated_cardinality = op->estimated_cardinality;
+	projection->has_estimated_cardinality = op->has_estimated_cardinality;
+	if (root.get() == op.get()) {
+		root = projection.get();
+	}
+	projection->children.push_back(std::move(op));
+	projection->ResolveOperatorTypes();
+	op = std::move(projection);
+
+	// the operators above the aggregate now reference the projection
+	ColumnBindingReplacer projection_replacer;
+	for (idx_t i = 0; i < bindings.size(); i++) {
+		projection_replacer.replacement_bindings.emplace_back(bindings[i], ColumnBinding(projection_index, i),
+		                                                      projection_types[i]);
+	}
+	projection_replacer.stop_operator = op.get();
+	projection_replacer.VisitOperator(*root);
+	return true;
+}
+
+} // namespace duckdb
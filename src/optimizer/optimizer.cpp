@@ -8,6 +8,7 @@
 #include "duckdb/optimizer/common_aggregate_optimizer.hpp"
 #include "duckdb/optimizer/cse_optimizer.hpp"
 #include "duckdb/optimizer/deliminator.hpp"
+#include "duckdb/optimizer/eager_aggregation.hpp"
 #include "duckdb/optimizer/expression_heuristics.hpp"
 #include "duckdb/optimizer/filter_pullup.hpp"
 #include "duckdb/optimizer/filter_pushdown.hpp"
@@ -90,6 +91,14 @@ unique_ptr<LogicalOperator> Optimizer::Optimize(unique_ptr<LogicalOperator> plan
 	}
 
 	this->plan = std::move(plan_p);
+	for (auto &optimizer_extension : DBConfig::GetConfig(context).optimizer_extensions) {
+		if (!optimizer_extension.pre_optimize_function) {
+			continue;
+		}
+		OptimizerExtensionInput input {context, *this, optimizer_extension.optimizer_info.get()};
+		RunOptimizer(OptimizerType::EXTENSION, [&]() { optimizer_extension.pre_optimize_function(input, plan); });
+	}
+
 	// first we perform expression rewrites using the ExpressionRewriter
 	// this does not change the logical plan structure, but only simplifies the expression trees
 	RunOptimizer(OptimizerType::EXPRESSION_REWRITER, [&]() { rewriter.VisitOperator(*plan); });
@@ -141,6 +150,12 @@ unique_ptr<LogicalOperator> Optimizer::Optimize(unique_ptr<LogicalOperator> plan
 		unused.VisitOperator(*plan);
 	});
 
+	// pre-aggregate the input of joins below aggregates
+	RunOptimizer(OptimizerType::EAGER_AGGREGATE, [&]() {
+		EagerAggregation eager_aggregation(*this);
+		plan = eager_aggregation.Optimize(std::move(plan));
+	});
+
 	// Remove duplicate groups from aggregates
 	RunOptimizer(OptimizerType::DUPLICATE_GROUPS, [&]() {
 		RemoveDuplicateGroups remove;
@@ -192,6 +207,9 @@ unique_ptr<LogicalOperator> Optimizer::Optimize(unique_ptr<LogicalOperator> plan
 	});
 
 	for (auto &optimizer_extension : DBConfig::GetConfig(context).optimizer_extensions) {
+		if (!optimizer_extension.optimize_function) {
+			continue;
+		}
 		RunOptimizer(OptimizerType::EXTENSION, [&]() {
 			optimizer_extension.optimize_function(context, optimizer_extension.optimizer_info.get(), plan);
 		});
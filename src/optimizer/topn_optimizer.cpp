@@ -1,8 +1,11 @@
 #include "duckdb/optimizer/topn_optimizer.hpp"
 
 #include "duckdb/common/limits.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/planner/operator/logical_limit.hpp"
 #include "duckdb/planner/operator/logical_order.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
 #include "duckdb/planner/operator/logical_top_n.hpp"
 
 namespace duckdb {
@@ -25,6 +28,78 @@ bool TopN::CanOptimize(LogicalOperator &op) {
 	return false;
 }
 
+static bool SupportsDynamicFilter(const LogicalType &type) {
+	if (type.IsIntegral()) {
+		return true;
+	}
+	switch (type.id()) {
+	case LogicalTypeId::DECIMAL:
+	case LogicalTypeId::DATE:
+	case LogicalTypeId::TIME:
+	case LogicalTypeId::TIMESTAMP:
+	case LogicalTypeId::TIMESTAMP_SEC:
+	case LogicalTypeId::TIMESTAMP_MS:
+	case LogicalTypeId::TIMESTAMP_NS:
+	case LogicalTypeId::TIMESTAMP_TZ:
+	case LogicalTypeId::VARCHAR:
+		return true;
+	default:
+		return false;
+	}
+}
+
+void TopN::PushdownDynamicFilters(LogicalTopN &op) {
+	auto &order = op.orders[0];
+	if (order.null_order != OrderByNullType::NULLS_LAST) {
+		// NULL values sort before the boundary value, but the filter would remove them
+		return;
+	}
+	if (order.expression->type != ExpressionType::BOUND_COLUMN_REF ||
+	    !SupportsDynamicFilter(order.expression->return_type)) {
+		return;
+	}
+	// follow the column through projections and filters to the scan it comes from
+	auto binding = order.expression->Cast<BoundColumnRefExpression>().binding;
+	reference<LogicalOperator> child = *op.children[0];
+	while (true) {
+		if (child.get().type == LogicalOperatorType::LOGICAL_PROJECTION) {
+			auto &projection = child.get().Cast<LogicalProjection>();
+			if (binding.table_index != projection.table_index) {
+				return;
+			}
+			auto &expr = projection.expressions[binding.column_index];
+			if (expr->type != ExpressionType::BOUND_COLUMN_REF) {
+				return;
+			}
+			binding = expr->Cast<BoundColumnRefExpression>().binding;
+		} else if (child.get().type != LogicalOperatorType::LOGICAL_FILTER) {
+			break;
+		}
+		child = *child.get().children[0];
+	}
+	if (child.get().type != LogicalOperatorType::LOGICAL_GET) {
+		return;
+	}
+	auto &get = child.get().Cast<LogicalGet>();
+	if (binding.table_index != get.table_index || !get.function.filter_pushdown || !get.children.empty()) {
+		return;
+	}
+	// only push into scans that evaluate all table filters themselves
+	auto &name = get.function.name;
+	if (name != "seq_scan" && name != "parquet_scan" && name != "read_parquet") {
+		return;
+	}
+	auto column_id = get.column_ids[binding.column_index];
+	if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+		return;
+	}
+	// rows past the boundary value of the heap can never make it into the top-n
+	auto comparison_type = order.type == OrderType::DESCENDING ? ExpressionType::COMPARE_GREATERTHANOREQUALTO
+	                                                           : ExpressionType::COMPARE_LESSTHANOREQUALTO;
+	op.dynamic_filter = make_shared_ptr<DynamicFilterData>(comparison_type);
+	get.table_filters.PushFilter(column_id, make_uniq<DynamicFilter>(op.dynamic_filter));
+}
+
 unique_ptr<LogicalOperator> TopN::Optimize(unique_ptr<LogicalOperator> op) {
 	if (CanOptimize(*op)) {
 		auto &limit = op->Cast<LogicalLimit>();
@@ -36,6 +111,7 @@ unique_ptr<LogicalOperator> TopN::Optimize(unique_ptr<LogicalOperator> op) {
 		}
 		auto topn = make_uniq<LogicalTopN>(std::move(order_by.orders), limit_val, offset_val);
 		topn->AddChild(std::move(order_by.children[0]));
+		PushdownDynamicFilters(*topn);
 		op = std::move(topn);
 	} else {
 		for (auto &child : op->children) {
@@ -0,0 +1,97 @@
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+
+#include "duckdb/storage/statistics/base_statistics.hpp"
+
+namespace duckdb {
+
+DynamicFilterData::DynamicFilterData(ExpressionType comparison_type_p)
+    : comparison_type(comparison_type_p), version(0) {
+}
+
+void DynamicFilterData::Tighten(const Value &constant) {
+	if (constant.IsNull()) {
+		return;
+	}
+	lock_guard<mutex> guard(lock);
+	if (filter) {
+		auto &current = filter->constant;
+		bool more_selective;
+		switch (comparison_type) {
+		case ExpressionType::COMPARE_LESSTHAN:
+		case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+			more_selective = constant < current;
+			break;
+		default:
+			more_selective = constant > current;
+			break;
+		}
+		if (!more_selective) {
+			return;
+		}
+	}
+	filter = make_shared_ptr<ConstantFilter>(comparison_type, constant);
+	version++;
+}
+
+void DynamicFilterData::Reset() {
+	lock_guard<mutex> guard(lock);
+	filter.reset();
+	version++;
+}
+
+shared_ptr<ConstantFilter> DynamicFilterData::GetFilter() {
+	lock_guard<mutex> guard(lock);
+	return filter;
+}
+
+optional_ptr<ConstantFilter> DynamicFilterData::GetFilter(DynamicFilterSnapshot &snapshot) {
+	if (snapshot.version != version.load()) {
+		lock_guard<mutex> guard(lock);
+		snapshot.filter = filter;
+		snapshot.version = version;
+	}
+	return snapshot.filter.get();
+}
+
+DynamicFilter::DynamicFilter() : TableFilter(TableFilterType::DYNAMIC_FILTER) {
+}
+
+DynamicFilter::DynamicFilter(shared_ptr<DynamicFilterData> filter_data_p)
+    : TableFilter(TableFilterType::DYNAMIC_FILTER), filter_data(std::move(filter_data_p)) {
+}
+
+shared_ptr<ConstantFilter> DynamicFilter::GetFilter() const {
+	if (!filter_data) {
+		return nullptr;
+	}
+	return filter_data->GetFilter();
+}
+
+optional_ptr<ConstantFilter> DynamicFilter::GetFilter(DynamicFilterSnapshot &snapshot) const {
+	if (!filter_data) {
+		return nullptr;
+	}
+	return filter_data->GetFilter(snapshot);
+}
+
+FilterPropagateResult DynamicFilter::CheckStatistics(BaseStatistics &stats) {
+	auto filter = GetFilter();
+	if (!filter) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	return filter->CheckStatistics(stats);
+}
+
+string DynamicFilter::ToString(const string &column_name) {
+	return "Dynamic Filter (" + column_name + ")";
+}
+
+bool DynamicFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<DynamicFilter>();
+	return other.filter_data == filter_data;
+}
+
+} // namespace duckdb
@@ -761,6 +761,10 @@ void DataTable::AppendLock(TableAppendState &state) {
 	state.current_row = state.row_start;
 }
 
+unique_lock<mutex> DataTable::CommitLock() {
+	return unique_lock<mutex>(commit_lock);
+}
+
 void DataTable::InitializeAppend(DuckTransaction &transaction, TableAppendState &state) {
 	// obtain the append lock for this table
 	if (!state.append_lock) {
@@ -1263,6 +1267,13 @@ unique_ptr<BaseStatistics> DataTable::GetStatistics(ClientContext &context, colu
 	return row_groups->CopyStats(column_id);
 }
 
+bool DataTable::RowGroupsOrderedOn(column_t column_id) {
+	if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+		return false;
+	}
+	return row_groups->RowGroupsOrderedOn(column_id);
+}
+
 void DataTable::SetDistinct(column_t column_id, unique_ptr<DistinctStatistics> distinct_stats) {
 	D_ASSERT(column_id != COLUMN_IDENTIFIER_ROW_ID);
 	row_groups->SetDistinct(column_id, std::move(distinct_stats));
@@ -1,4 +1,5 @@
 #include "duckdb/transaction/local_storage.hpp"
+#include "duckdb/common/algorithm.hpp"
 #include "duckdb/execution/index/art/art.hpp"
 #include "duckdb/storage/table/append_state.hpp"
 #include "duckdb/storage/write_ahead_log.hpp"
@@ -490,6 +491,17 @@ void LocalStorage::Commit(LocalStorage::CommitState &commit_state, DuckTransacti
 	// iterate over all entries in the table storage map and commit them
 	// after this, the local storage is no longer required and can be cleared
 	auto table_storage = table_manager.MoveEntries();
+	// obtain the commit locks of all tables we are flushing to
+	// the locks are obtained in a fixed order to prevent deadlocks between concurrently committing transactions
+	vector<reference<DataTable>> tables;
+	for (auto &entry : table_storage) {
+		tables.push_back(entry.first);
+	}
+	std::sort(tables.begin(), tables.end(),
+	          [](const reference<DataTable> &a, const reference<DataTable> &b) { return &a.get() < &b.get(); });
+	for (auto &table : tables) {
+		commit_state.commit_locks.push_back(table.get().CommitLock());
+	}
 	for (auto &entry : table_storage) {
 		auto table = entry.first;
 		auto storage = entry.second.get();
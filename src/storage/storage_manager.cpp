@@ -57,17 +57,21 @@ bool ObjectCache::ObjectCacheEnabled(ClientContext &context) {
 }
 
 optional_ptr<WriteAheadLog> StorageManager::GetWriteAheadLog() {
+	return GetSharedWriteAheadLog().get();
+}
+
+shared_ptr<WriteAheadLog> StorageManager::GetSharedWriteAheadLog() {
 	if (InMemory() || read_only || !load_complete) {
 		return nullptr;
 	}
 
 	if (wal) {
-		return wal.get();
+		return wal;
 	}
 
 	// lazy WAL creation
-	wal = make_uniq<WriteAheadLog>(db, GetWALPath());
-	return wal.get();
+	wal = make_shared_ptr<WriteAheadLog>(db, GetWALPath());
+	return wal;
 }
 
 string StorageManager::GetWALPath() {
@@ -240,7 +244,7 @@ void SingleFileStorageCommitState::FlushCommit() {
 			(void)checkpoint;
 			D_ASSERT(!checkpoint);
 			D_ASSERT(!log->skip_writing);
-			log->Flush();
+			log->FlushCommit();
 		}
 		log->skip_writing = false;
 	}
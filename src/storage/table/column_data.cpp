@@ -149,6 +149,14 @@ unique_ptr<BaseStatistics> ColumnData::GetUpdateStatistics() {
 	return updates ? updates->GetStatistics() : nullptr;
 }
 
+bool ColumnData::HasFullUpdates(idx_t vector_index, idx_t scan_count) const {
+	lock_guard<mutex> update_guard(update_lock);
+	if (!updates) {
+		return false;
+	}
+	return updates->HasFullUpdates(vector_index, scan_count);
+}
+
 void ColumnData::FetchUpdates(TransactionData transaction, idx_t vector_index, Vector &result, idx_t scan_count,
                               bool allow_updates, bool scan_committed) {
 	lock_guard<mutex> update_guard(update_lock);
@@ -188,6 +196,14 @@ idx_t ColumnData::ScanVector(TransactionData transaction, idx_t vector_index, Co
 	idx_t current_row = vector_index * STANDARD_VECTOR_SIZE;
 	auto vector_count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, count - current_row);
 
+	if (HasFullUpdates(vector_index, vector_count)) {
+		// every row of this vector has been updated (e.g. by a bulk update) - the base data is always overwritten
+		// skip decompressing the base data and only move the scan state forward
+		state.previous_states.clear();
+		state.NextInternal(vector_count);
+		FetchUpdates(transaction, vector_index, result, vector_count, ALLOW_UPDATES, SCAN_COMMITTED);
+		return vector_count;
+	}
 	auto scan_count = ScanVector(state, result, vector_count, HasUpdates());
 	FetchUpdates(transaction, vector_index, result, scan_count, ALLOW_UPDATES, SCAN_COMMITTED);
 	return scan_count;
@@ -240,6 +256,14 @@ void ColumnData::Select(TransactionData transaction, idx_t vector_index, ColumnS
 
 	UnifiedVectorFormat vdata;
 	result.ToUnifiedFormat(scan_count, vdata);
+	if (filter.filter_type == TableFilterType::DYNAMIC_FILTER) {
+		// the current constant of a dynamic filter is read through the snapshot of this scan
+		auto constant_filter = filter.Cast<DynamicFilter>().GetFilter(state.dynamic_filter);
+		if (constant_filter) {
+			ColumnSegment::FilterSelection(sel, result, vdata, *constant_filter, scan_count, s_count);
+		}
+		return;
+	}
 	ColumnSegment::FilterSelection(sel, result, vdata, filter, scan_count, s_count);
 }
 
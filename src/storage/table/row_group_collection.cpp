@@ -1158,6 +1158,44 @@ unique_ptr<BaseStatistics> RowGroupCollection::CopyStats(column_t column_id) {
 	return stats.CopyStats(column_id);
 }
 
+bool RowGroupCollection::RowGroupsOrderedOn(column_t column_id) {
+	// checking the statistics of every row group is linear in the size of the table: only check them again after the
+	// number of rows has changed. A result that is out of date (e.g. after an update) only affects performance, the
+	// order is verified when it is used
+	const idx_t row_count = total_rows;
+	lock_guard<mutex> guard(ordered_lock);
+	auto entry = ordered_columns.find(column_id);
+	if (entry != ordered_columns.end() && entry->second.first == row_count) {
+		return entry->second.second;
+	}
+
+	bool ordered = true;
+	idx_t ordered_row_groups = 0;
+	Value previous_max;
+	for (auto &row_group : row_groups->Segments()) {
+		auto row_group_stats = row_group.GetStatistics(column_id);
+		if (row_group_stats->GetStatsType() != StatisticsType::NUMERIC_STATS) {
+			ordered = false;
+			break;
+		}
+		if (!NumericStats::HasMinMax(*row_group_stats)) {
+			// the row group only contains NULL values
+			continue;
+		}
+		auto min = NumericStats::Min(*row_group_stats);
+		if (!previous_max.IsNull() && min < previous_max) {
+			ordered = false;
+			break;
+		}
+		previous_max = NumericStats::Max(*row_group_stats);
+		ordered_row_groups++;
+	}
+	// a single row group says nothing about the order of the rows within it
+	ordered = ordered && ordered_row_groups > 1;
+	ordered_columns[column_id] = make_pair(row_count, ordered);
+	return ordered;
+}
+
 void RowGroupCollection::SetDistinct(column_t column_id, unique_ptr<DistinctStatistics> distinct_stats) {
 	D_ASSERT(column_id != COLUMN_IDENTIFIER_ROW_ID);
 	auto stats_guard = stats.GetLock();
@@ -98,11 +98,17 @@ static void UpdateMergeValidity(transaction_t start_time, transaction_t transact
 	                                  [&](UpdateInfo *current) { MergeValidityInfo(current, result_mask); });
 }
 
+//! Whether or not the update info contains a dense run of tuples starting at the beginning of the vector
+//! as the tuples are sorted and unique, this is the case if the last tuple is equal to N - 1
+static bool IsDenseUpdate(const UpdateInfo &info) {
+	return info.N > 0 && info.tuples[info.N - 1] == info.N - 1;
+}
+
 template <class T>
 static void MergeUpdateInfo(UpdateInfo *current, T *result_data) {
 	auto info_data = reinterpret_cast<T *>(current->tuple_data);
-	if (current->N == STANDARD_VECTOR_SIZE) {
-		// special case: update touches ALL tuples of this vector
+	if (IsDenseUpdate(*current)) {
+		// special case: update touches the first N tuples of this vector (e.g. as part of a bulk update)
 		// in this case we can just memcpy the data
 		// since the layout of the update info is guaranteed to be [0, 1, 2, 3, ...]
 		memcpy(result_data, info_data, sizeof(T) * current->N);
@@ -1209,6 +1215,17 @@ bool UpdateSegment::HasUpdates(idx_t vector_index) const {
 	return root->info[vector_index].get();
 }
 
+bool UpdateSegment::HasFullUpdates(idx_t vector_index, idx_t count) {
+	if (!HasUpdates(vector_index)) {
+		return false;
+	}
+	// note that the base info only ever grows: tuples are never removed from it (not even on rollback)
+	// as such, once a vector is fully covered by updates it remains so
+	auto read_lock = lock.GetSharedLock();
+	auto &base_info = *root->info[vector_index]->info;
+	return base_info.N >= count && IsDenseUpdate(base_info);
+}
+
 bool UpdateSegment::HasUncommittedUpdates(idx_t vector_index) {
 	if (!HasUpdates(vector_index)) {
 		return false;
@@ -6,8 +6,11 @@
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_entry/type_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_entry/view_catalog_entry.hpp"
+#include "duckdb/common/chrono.hpp"
 #include "duckdb/common/serializer/binary_serializer.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/main/valid_checker.hpp"
 #include "duckdb/parser/parsed_data/alter_table_info.hpp"
 #include "duckdb/storage/index.hpp"
 #include "duckdb/storage/table/data_table_info.hpp"
@@ -19,7 +22,9 @@ namespace duckdb {
 
 const uint64_t WAL_VERSION_NUMBER = 2;
 
-WriteAheadLog::WriteAheadLog(AttachedDatabase &database, const string &path) : skip_writing(false), database(database) {
+WriteAheadLog::WriteAheadLog(AttachedDatabase &database, const string &path)
+    : skip_writing(false), database(database), flushed_commits(0), synced_commits(0), sync_in_progress(false),
+      sync_failed(false), stop_sync_thread(false) {
 	wal_path = path;
 	writer = make_uniq<BufferedFileWriter>(FileSystem::Get(database), path,
 	                                       FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE |
@@ -27,6 +32,7 @@ WriteAheadLog::WriteAheadLog(AttachedDatabase &database, const string &path) : s
 }
 
 WriteAheadLog::~WriteAheadLog() {
+	StopSyncThread();
 }
 
 int64_t WriteAheadLog::GetWALSize() {
@@ -47,6 +53,13 @@ void WriteAheadLog::Delete() {
 	if (!writer) {
 		return;
 	}
+	StopSyncThread();
+	{
+		// wait for a committer that is still syncing the WAL - the commits are covered by the checkpoint from now on
+		unique_lock<mutex> guard(sync_lock);
+		sync_cv.wait(guard, [&]() { return !sync_in_progress; });
+		synced_commits = flushed_commits;
+	}
 	writer.reset();
 
 	auto &fs = FileSystem::Get(database);
@@ -392,6 +405,117 @@ void WriteAheadLog::Flush() {
 
 	// flushes all changes made to the WAL to disk
 	writer->Sync();
+
+	lock_guard<mutex> guard(sync_lock);
+	synced_commits = flushed_commits;
+}
+
+void WriteAheadLog::FlushCommit() {
+	if (skip_writing) {
+		return;
+	}
+	auto commit_mode = DBConfig::Get(database).options.wal_commit_mode;
+#ifdef DUCKDB_NO_THREADS
+	// without threads there is no background thread that can sync the WAL
+	if (commit_mode == WALCommitMode::ASYNC) {
+		commit_mode = WALCommitMode::SYNC;
+	}
+#endif
+	if (commit_mode == WALCommitMode::SYNC) {
+		{
+			lock_guard<mutex> guard(sync_lock);
+			flushed_commits++;
+		}
+		Flush();
+		return;
+	}
+	// write an empty entry
+	WriteAheadLogSerializer serializer(*this, WALType::WAL_FLUSH);
+	serializer.End();
+
+	// write the changes to the file - but do not sync them yet
+	writer->Flush();
+
+	lock_guard<mutex> guard(sync_lock);
+	flushed_commits++;
+#ifndef DUCKDB_NO_THREADS
+	if (commit_mode == WALCommitMode::ASYNC && !sync_thread) {
+		sync_thread = make_uniq<thread>([this]() { SyncThreadLoop(); });
+	}
+#endif
+}
+
+void WriteAheadLog::SyncCommits() {
+	unique_lock<mutex> guard(sync_lock);
+	SyncInternal(guard, flushed_commits);
+}
+
+void WriteAheadLog::SyncInternal(unique_lock<mutex> &guard, idx_t target) {
+	while (synced_commits < target) {
+		if (sync_failed) {
+			throw FatalException("Failed to sync the write-ahead log");
+		}
+		if (sync_in_progress) {
+			// another thread is syncing the WAL - wait for it to finish and check if it covered our commits
+			sync_cv.wait(guard);
+			continue;
+		}
+		// sync the WAL - this covers all commits that have been flushed to the file so far
+		sync_in_progress = true;
+		auto sync_target = flushed_commits;
+		guard.unlock();
+		ErrorData error;
+		try {
+			writer->handle->Sync();
+		} catch (std::exception &ex) {
+			error = ErrorData(ex);
+		}
+		guard.lock();
+		sync_in_progress = false;
+		sync_cv.notify_all();
+		if (error.HasError()) {
+			// the changes might already be lost - never retry the sync, but invalidate the database instead, so that
+			// neither the flushed commits nor anything that depends on them can be read
+			sync_failed = true;
+			ValidChecker::Invalidate(database.GetDatabase(), error.RawMessage());
+			throw FatalException("Failed to sync the write-ahead log: %s", error.RawMessage());
+		}
+		synced_commits = MaxValue(synced_commits, sync_target);
+	}
+}
+
+void WriteAheadLog::SyncThreadLoop() {
+	unique_lock<mutex> guard(sync_lock);
+	while (true) {
+		try {
+			SyncInternal(guard, flushed_commits);
+		} catch (std::exception &) {
+			// the commits have already been acknowledged - we cannot recover from a failed sync, which has
+			// invalidated the database
+			return;
+		}
+		if (stop_sync_thread) {
+			return;
+		}
+		auto interval = DBConfig::Get(database).options.wal_async_commit_interval;
+		sync_cv.wait_for(guard, milliseconds(interval), [&]() { return stop_sync_thread; });
+	}
+}
+
+void WriteAheadLog::StopSyncThread() {
+	unique_ptr<thread> thread_to_join;
+	{
+		lock_guard<mutex> guard(sync_lock);
+		if (!sync_thread) {
+			return;
+		}
+		stop_sync_thread = true;
+		thread_to_join = std::move(sync_thread);
+	}
+	// the sync thread syncs any remaining commits before it exits
+	sync_cv.notify_all();
+	thread_to_join->join();
+	stop_sync_thread = false;
 }
 
 } // namespace duckdb
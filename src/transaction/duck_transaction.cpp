@@ -131,6 +131,15 @@ bool DuckTransaction::AutomaticCheckpoint(AttachedDatabase &db) {
 	return storage_manager.AutomaticCheckpoint(storage->EstimatedSize() + undo_buffer.EstimatedSize());
 }
 
+ErrorData DuckTransaction::FlushLocalStorage(LocalStorage::CommitState &commit_state) noexcept {
+	try {
+		storage->Commit(commit_state, *this);
+		return ErrorData();
+	} catch (std::exception &ex) {
+		return ErrorData(ex);
+	}
+}
+
 ErrorData DuckTransaction::Commit(AttachedDatabase &db, transaction_t commit_id, bool checkpoint) noexcept {
 	// "checkpoint" parameter indicates if the caller will checkpoint. If checkpoint ==
 	//    true: Then this function will NOT write to the WAL or flush/persist.
@@ -139,7 +148,6 @@ ErrorData DuckTransaction::Commit(AttachedDatabase &db, transaction_t commit_id,
 	this->commit_id = commit_id;
 
 	UndoBuffer::IteratorState iterator_state;
-	LocalStorage::CommitState commit_state;
 	unique_ptr<StorageCommitState> storage_commit_state;
 	optional_ptr<WriteAheadLog> log;
 	if (!db.IsSystem()) {
@@ -151,7 +159,8 @@ ErrorData DuckTransaction::Commit(AttachedDatabase &db, transaction_t commit_id,
 	}
 
 	try {
-		storage->Commit(commit_state, *this);
+		// the transaction-local storage has already been flushed to the base tables in FlushLocalStorage
+		D_ASSERT(!storage->ChangesMade());
 		undo_buffer.Commit(iterator_state, log, commit_id);
 		if (log) {
 			// commit any sequences that were used to the WAL
@@ -8,8 +8,10 @@
 #include "duckdb/catalog/catalog.hpp"
 #include "duckdb/catalog/dependency_manager.hpp"
 #include "duckdb/storage/storage_manager.hpp"
+#include "duckdb/storage/write_ahead_log.hpp"
 #include "duckdb/transaction/duck_transaction.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/main/connection_manager.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/database_manager.hpp"
@@ -68,7 +70,7 @@ DuckTransactionManager &DuckTransactionManager::Get(AttachedDatabase &db) {
 
 Transaction &DuckTransactionManager::StartTransaction(ClientContext &context) {
 	// obtain the transaction lock during this function
-	lock_guard<mutex> lock(transaction_lock);
+	unique_lock<mutex> lock(transaction_lock);
 	if (current_start_timestamp >= TRANSACTION_ID_START) { // LCOV_EXCL_START
 		throw InternalException("Cannot start more transactions, ran out of "
 		                        "transaction identifiers!");
@@ -88,6 +90,19 @@ Transaction &DuckTransactionManager::StartTransaction(ClientContext &context) {
 
 	// store it in the set of active transactions
 	active_transactions.push_back(std::move(transaction));
+
+	auto commit_log = group_commit_log;
+	if (commit_log) {
+		// wait until the commits this transaction can see are synced, so that it cannot read changes that are lost
+		lock.unlock();
+		try {
+			commit_log->SyncCommits();
+		} catch (...) {
+			lock.lock();
+			RemoveTransaction(transaction_ref);
+			throw;
+		}
+	}
 	return transaction_ref;
 }
 
@@ -182,13 +197,28 @@ DuckTransactionManager::CanCheckpoint(optional_ptr<DuckTransaction> current) {
 ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Transaction &transaction_p) {
 	auto &transaction = transaction_p.Cast<DuckTransaction>();
 	vector<ClientLockWrapper> client_locks;
+	// determine whether or not this commit should trigger an automatic checkpoint before flushing the local storage
+	// (the system catalog has no storage and never checkpoints)
+	auto automatic_checkpoint = !db.IsSystem() && transaction.AutomaticCheckpoint(db);
+	// flush the transaction-local storage into the base tables
+	// this happens before obtaining the transaction lock, so that transactions writing to different tables can flush
+	// concurrently - the commit locks of the flushed tables are held until the commit (or rollback) is finished
+	LocalStorage::CommitState commit_state;
+	auto error = transaction.FlushLocalStorage(commit_state);
+
 	auto lock = make_uniq<lock_guard<mutex>>(transaction_lock);
 	CheckpointLock checkpoint_lock(*this);
 	// check if we can checkpoint
-	auto checkpoint_decision = thread_is_checkpointing ? CheckpointDecision {false, "another thread is checkpointing"}
-	                                                   : CanCheckpoint(&transaction);
+	CheckpointDecision checkpoint_decision;
+	if (error.HasError()) {
+		checkpoint_decision = {false, error.Message()};
+	} else if (thread_is_checkpointing) {
+		checkpoint_decision = {false, "another thread is checkpointing"};
+	} else {
+		checkpoint_decision = CanCheckpoint(&transaction);
+	}
 	if (checkpoint_decision.can_checkpoint) {
-		if (transaction.AutomaticCheckpoint(db)) {
+		if (automatic_checkpoint) {
 			checkpoint_lock.Lock();
 		} else {
 			checkpoint_decision = {false, "no reason to automatically checkpoint"};
@@ -196,10 +226,12 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 	}
 	OnCommitCheckpointDecision(checkpoint_decision, transaction);
 
-	// obtain a commit id for the transaction
-	transaction_t commit_id = current_start_timestamp++;
-	// commit the UndoBuffer of the transaction
-	auto error = transaction.Commit(db, commit_id, checkpoint_decision.can_checkpoint);
+	if (!error.HasError()) {
+		// obtain a commit id for the transaction
+		transaction_t commit_id = current_start_timestamp++;
+		// commit the UndoBuffer of the transaction
+		error = transaction.Commit(db, commit_id, checkpoint_decision.can_checkpoint);
+	}
 	if (error.HasError()) {
 		// commit unsuccessful: rollback the transaction instead
 		checkpoint_decision = CheckpointDecision {false, error.Message()};
@@ -212,6 +244,14 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 		client_locks.clear();
 	}
 
+	// in GROUP commit mode the WAL is synced after releasing the transaction lock, so concurrent commits share a sync
+	shared_ptr<WriteAheadLog> commit_log;
+	if (!error.HasError() && !checkpoint_decision.can_checkpoint && !db.IsSystem() && transaction.ChangesMade() &&
+	    DBConfig::Get(db).options.wal_commit_mode == WALCommitMode::GROUP) {
+		commit_log = db.GetStorageManager().GetSharedWriteAheadLog();
+		group_commit_log = commit_log;
+	}
+
 	// commit successful: remove the transaction id from the list of active transactions
 	// potentially resulting in garbage collection
 	RemoveTransaction(transaction);
@@ -222,6 +262,14 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 		auto &storage_manager = db.GetStorageManager();
 		storage_manager.CreateCheckpoint(false, true);
 	}
+	if (commit_log) {
+		lock.reset();
+		try {
+			commit_log->SyncCommits();
+		} catch (std::exception &ex) {
+			error = ErrorData(ex);
+		}
+	}
 	return error;
 }
 
@@ -21,6 +21,7 @@ data_ptr_t UndoBuffer::CreateEntry(UndoFlags type, idx_t len) {
 	D_ASSERT(len <= NumericLimits<uint32_t>::Maximum());
 	len = AlignValue(len);
 	idx_t needed_space = len + UNDO_ENTRY_HEADER_SIZE;
+	lock_guard<mutex> guard(entry_lock);
 	auto data = allocator.Allocate(needed_space);
 	Store<UndoFlags>(type, data);
 	data += sizeof(UndoFlags);
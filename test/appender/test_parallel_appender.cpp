@@ -0,0 +1,125 @@
+#include "catch.hpp"
+#include "duckdb/main/appender.hpp"
+#include "test_helpers.hpp"
+
+#include <thread>
+
+using namespace duckdb;
+using namespace std;
+
+#define PARALLEL_APPEND_THREADS 4
+
+static void parallel_append_to_integers(ParallelAppender *parallel_appender, idx_t offset, idx_t count) {
+	auto appender = parallel_appender->CreateAppender();
+	for (idx_t i = 0; i < count; i++) {
+		appender->AppendRow(int64_t(offset + i), int32_t(i % 10));
+	}
+	appender->Close();
+}
+
+TEST_CASE("Test parallel appender", "[appender]") {
+	duckdb::unique_ptr<QueryResult> result;
+	DuckDB db(nullptr);
+	Connection con(db);
+	Connection con2(db);
+
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers(i BIGINT, j INTEGER NOT NULL)"));
+
+	// the second round appends enough rows per thread to write full row groups directly to storage
+	idx_t counts[] = {1000, 200000};
+	idx_t total_count = 0;
+	for (auto count : counts) {
+		ParallelAppender parallel_appender(con, "integers");
+		thread threads[PARALLEL_APPEND_THREADS];
+		for (idx_t i = 0; i < PARALLEL_APPEND_THREADS; i++) {
+			threads[i] = thread(parallel_append_to_integers, &parallel_appender, total_count + i * count, count);
+		}
+		for (idx_t i = 0; i < PARALLEL_APPEND_THREADS; i++) {
+			threads[i].join();
+		}
+		// the appended data is not visible to other connections before the commit
+		result = con2.Query("SELECT COUNT(*) FROM integers");
+		REQUIRE(CHECK_COLUMN(result, 0, {Value::BIGINT(NumericCast<int64_t>(total_count))}));
+
+		parallel_appender.Commit();
+		total_count += count * PARALLEL_APPEND_THREADS;
+	}
+	result = con2.Query("SELECT COUNT(*), COUNT(DISTINCT i), SUM(i), MIN(i), MAX(i) FROM integers");
+	REQUIRE(CHECK_COLUMN(result, 0, {Value::BIGINT(NumericCast<int64_t>(total_count))}));
+	REQUIRE(CHECK_COLUMN(result, 1, {Value::BIGINT(NumericCast<int64_t>(total_count))}));
+	REQUIRE(CHECK_COLUMN(result, 2, {Value::HUGEINT(NumericCast<int64_t>(total_count * (total_count - 1) / 2))}));
+	REQUIRE(CHECK_COLUMN(result, 3, {0}));
+	REQUIRE(CHECK_COLUMN(result, 4, {Value::BIGINT(NumericCast<int64_t>(total_count - 1))}));
+
+	// the connection can be used normally again after committing
+	REQUIRE_NO_FAIL(con.Query("INSERT INTO integers VALUES (-1, 0)"));
+	result = con.Query("SELECT COUNT(*) FROM integers");
+	REQUIRE(CHECK_COLUMN(result, 0, {Value::BIGINT(NumericCast<int64_t>(total_count + 1))}));
+}
+
+TEST_CASE("Test parallel appender constraint violations and rollback", "[appender]") {
+	duckdb::unique_ptr<QueryResult> result;
+	DuckDB db(nullptr);
+	Connection con(db);
+
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers(i INTEGER PRIMARY KEY, j INTEGER NOT NULL)"));
+	REQUIRE_NO_FAIL(con.Query("INSERT INTO integers VALUES (1, 1)"));
+
+	// NOT NULL violation
+	{
+		ParallelAppender parallel_appender(con, "integers");
+		auto appender = parallel_appender.CreateAppender();
+		appender->AppendRow(2, nullptr);
+		REQUIRE_THROWS(appender->Flush());
+		appender.reset();
+		REQUIRE_THROWS(parallel_appender.Commit());
+	}
+	// duplicate with a committed row
+	{
+		ParallelAppender parallel_appender(con, "integers");
+		auto appender = parallel_appender.CreateAppender();
+		appender->AppendRow(1, 1);
+		REQUIRE_THROWS(appender->Flush());
+	}
+	// duplicate between two appenders is detected on commit
+	{
+		ParallelAppender parallel_appender(con, "integers");
+		auto appender1 = parallel_appender.CreateAppender();
+		auto appender2 = parallel_appender.CreateAppender();
+		appender1->AppendRow(2, 2);
+		appender2->AppendRow(2, 2);
+		appender1.reset();
+		appender2.reset();
+		REQUIRE_THROWS(parallel_appender.Commit());
+	}
+	// appenders that have not been destroyed cannot be committed
+	{
+		ParallelAppender parallel_appender(con, "integers");
+		auto appender = parallel_appender.CreateAppender();
+		appender->AppendRow(4, 4);
+		REQUIRE_THROWS(parallel_appender.Commit());
+		appender.reset();
+		parallel_appender.Commit();
+		REQUIRE_THROWS(parallel_appender.CreateAppender());
+	}
+	REQUIRE_NO_FAIL(con.Query("DELETE FROM integers WHERE i = 4"));
+	// appends that are not committed are rolled back
+	{
+		ParallelAppender parallel_appender(con, "integers");
+		auto appender = parallel_appender.CreateAppender();
+		appender->AppendRow(3, 3);
+		appender->Close();
+	}
+	result = con.Query("SELECT COUNT(*), SUM(i) FROM integers");
+	REQUIRE(CHECK_COLUMN(result, 0, {1}));
+	REQUIRE(CHECK_COLUMN(result, 1, {1}));
+
+	// starting a parallel appender within a transaction is not supported
+	REQUIRE_NO_FAIL(con.Query("BEGIN TRANSACTION"));
+	REQUIRE_THROWS(ParallelAppender(con, "integers"));
+	REQUIRE_NO_FAIL(con.Query("ROLLBACK"));
+
+	// non-existent table
+	REQUIRE_THROWS(ParallelAppender(con, "nonexistent"));
+	REQUIRE_NO_FAIL(con.Query("SELECT 42"));
+}
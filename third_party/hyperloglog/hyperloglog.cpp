@@ -1247,6 +1247,33 @@ uint64_t get_size() {
 	return HLL_DENSE_SIZE;
 }
 
+uint64_t get_register_count() {
+	return HLL_REGISTERS;
+}
+
+int hll_get_registers(robj *o, uint8_t *registers) {
+    memset(registers, 0, HLL_REGISTERS);
+    return hllMerge(registers, o);
+}
+
+int hll_set_registers(robj *o, const uint8_t *registers) {
+    struct hllhdr *hdr;
+    long j;
+
+    for (j = 0; j < HLL_REGISTERS; j++) {
+        if (registers[j] == 0) continue;
+        if (registers[j] > HLL_REGISTER_MAX) return HLL_C_ERR;
+        /* Sparse sets can promote the HLL to the dense representation. */
+        hdr = (struct hllhdr *) o->ptr;
+        switch(hdr->encoding) {
+        case HLL_DENSE: hllDenseSet(hdr->registers + 1,j,registers[j]); break;
+        case HLL_SPARSE: if (hllSparseSet(o,j,registers[j]) == -1) return HLL_C_ERR; break;
+        }
+    }
+    HLL_INVALIDATE_CACHE((struct hllhdr *) o->ptr);
+    return HLL_C_OK;
+}
+
 }
 
 namespace duckdb {
@@ -39,6 +39,13 @@ int hll_count(robj *o, size_t *result);
 robj *hll_merge(robj **hlls, size_t hll_count);
 //! Get size (in bytes) of the HLL
 uint64_t get_size();
+//! Get the amount of registers of the HLL
+uint64_t get_register_count();
+//! Write the get_register_count() registers of the HLL to 'registers'. Returns C_OK on success, or C_ERR on failure.
+int hll_get_registers(robj *o, uint8_t *registers);
+//! Raise the registers of the HLL to (at least) the values in 'registers'. Returns C_OK on success, or C_ERR if a
+//! register value is out of range.
+int hll_set_registers(robj *o, const uint8_t *registers);
 
 uint64_t MurmurHash64A(const void *key, int len, unsigned int seed);
 